@@ -415,6 +415,87 @@ def init_jvm(java_home=None,
     return cdll, jvm_options
 
 
+def _get_type_cache_fingerprint():
+    """
+    Computes a fingerprint of the Java runtime and class path used by jpy. It changes if any class path entry
+    is added or removed, if a JAR file is modified, or if the modification time of a class path directory changes.
+    The files within class path directories are not looked at, classes whose members have changed are detected
+    when their types are resolved.
+    """
+    import hashlib
+    import jpy
+
+    System = jpy.get_type('java.lang.System')
+    fingerprint = hashlib.sha1()
+    for key in ('java.vm.name', 'java.version', 'java.home'):
+        fingerprint.update(str(System.getProperty(key)).encode('utf-8'))
+
+    class_path = System.getProperty('java.class.path')
+    for entry in (class_path.split(os.pathsep) if class_path else []):
+        fingerprint.update(entry.encode('utf-8'))
+        if os.path.exists(entry):
+            stat = os.stat(entry)
+            size = stat.st_size if os.path.isfile(entry) else 0
+            fingerprint.update(('%d:%d' % (size, int(stat.st_mtime))).encode('utf-8'))
+
+    return fingerprint.hexdigest()
+
+
+def save_type_cache(cache_file, fingerprint=None):
+    """
+    Saves the metadata of all Java types resolved so far into the given cache file. Later processes using the same
+    Java runtime and class path can use it to avoid reflecting the members of these types, see `load_type_cache()`.
+
+    :param cache_file: The type cache file to be written.
+    :param fingerprint: An optional string identifying the Java runtime and class path, e.g. an application version.
+           If not given, it is computed from the Java runtime and the class path entries.
+    """
+    import json
+    import jpy
+
+    if fingerprint is None:
+        fingerprint = _get_type_cache_fingerprint()
+    cache = {'fingerprint': fingerprint, 'types': jpy.get_type_metadata()}
+    with open(cache_file, 'w') as f:
+        json.dump(cache, f)
+
+
+def load_type_cache(cache_file, fingerprint=None):
+    """
+    Loads the Java type metadata written by `save_type_cache()`, so that the members of the cached types are looked up
+    by their signatures instead of being reflected when the types are resolved. Classes whose members don't match
+    the cached ones are reflected as usual. Should be called right after the JVM has been created.
+
+    :param cache_file: The type cache file to be read.
+    :param fingerprint: An optional string that must equal the one passed to `save_type_cache()`. If not given, it is
+           computed from the Java runtime and the class path entries.
+    :return: True, if the cache has been loaded. False, if the file can't be read, is malformed or has been written
+             for another Java runtime or class path.
+    """
+    import json
+    import jpy
+
+    try:
+        with open(cache_file, 'r') as f:
+            cache = json.load(f)
+    except (IOError, OSError, ValueError) as e:
+        logging.debug('Failed to read type cache file %s: %s' % (cache_file, e))
+        return False
+
+    if fingerprint is None:
+        fingerprint = _get_type_cache_fingerprint()
+    if cache.get('fingerprint') != fingerprint:
+        logging.debug('Type cache file %s is outdated' % cache_file)
+        return False
+
+    try:
+        jpy.set_type_metadata(cache['types'])
+    except (KeyError, TypeError, ValueError) as e:
+        logging.debug('Failed to load type cache file %s: %s' % (cache_file, e))
+        return False
+    return True
+
+
 class Config:
     def load(self, path):
         """
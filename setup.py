@@ -57,6 +57,7 @@ sources = [
     os.path.join(src_main_c_dir, 'jpy_compat.c'),
     os.path.join(src_main_c_dir, 'jpy_jtype.c'),
     os.path.join(src_main_c_dir, 'jpy_jarray.c'),
+    os.path.join(src_main_c_dir, 'jpy_jbuffer.c'),
     os.path.join(src_main_c_dir, 'jpy_jobj.c'),
     os.path.join(src_main_c_dir, 'jpy_jmethod.c'),
     os.path.join(src_main_c_dir, 'jpy_jfield.c'),
@@ -70,6 +71,7 @@ headers = [
     os.path.join(src_main_c_dir, 'jpy_compat.h'),
     os.path.join(src_main_c_dir, 'jpy_jtype.h'),
     os.path.join(src_main_c_dir, 'jpy_jarray.h'),
+    os.path.join(src_main_c_dir, 'jpy_jbuffer.h'),
     os.path.join(src_main_c_dir, 'jpy_jobj.h'),
     os.path.join(src_main_c_dir, 'jpy_jmethod.h'),
     os.path.join(src_main_c_dir, 'jpy_jfield.h'),
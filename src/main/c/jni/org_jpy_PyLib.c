@@ -29,13 +29,71 @@
 // Note: Native org.jpy.PyLib function definition headers in this file are formatted according to the header
 // generated by javah. This makes it easier to follow up changes in the header.
 
+PyObject* PyLib_GetPyName(JNIEnv* jenv, jstring jName);
+void PyLib_ClearNameCache(void);
 PyObject* PyLib_GetAttributeObject(JNIEnv* jenv, PyObject* pyValue, jstring jName);
+PyObject* PyLib_GetAttributeObjectWithName(JNIEnv* jenv, PyObject* pyObject, PyObject* pyName);
 PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyValue, jboolean isMethodCall, jstring jName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses);
+PyObject* PyLib_CallAndReturnObjectWithName(JNIEnv *jenv, PyObject* pyObject, jboolean isMethodCall, PyObject* pyName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses);
 void PyLib_HandlePythonException(JNIEnv* jenv);
 void PyLib_RedirectStdOut(void);
 
+/**
+ * A call plan created by PyLib.createCallPlan() for repeated calls of the same Python callable,
+ * e.g. from the methods of Java proxy instances.
+ */
+typedef struct PyLib_CallPlan
+{
+    // The UTF-8 name of the callable
+    char* nameChars;
+    jint paramCount;
+    // Global references to the parameter classes
+    jclass* paramClasses;
+    // Global reference to the return class, may be NULL
+    jclass returnClass;
+    // The following members are resolved on first use and are valid as long as generation == PyLib_Generation
+    int generation;
+    // The interned name of the callable
+    PyObject* pyName;
+    // Borrowed references to the types of the parameter classes
+    JPy_JType** paramTypes;
+    // Borrowed reference to the type of the return class, may be NULL
+    JPy_JType* returnType;
+}
+PyLib_CallPlan;
+
+PyObject* PyLib_CallPlanAndReturnObject(JNIEnv *jenv, PyObject* pyObject, PyLib_CallPlan* plan, jobjectArray jArgs);
+
 static int JPy_InitThreads = 0;
 
+// Incremented each time the Python interpreter is stopped, so that call plans resolve their Python objects again
+static int PyLib_Generation = 1;
+
+/**
+ * The size of the cache of interned Python attribute names, see PyLib_GetPyName().
+ */
+#define PyLib_NAME_CACHE_SIZE 256
+/**
+ * The maximum length of names kept in the cache. Longer names are always converted.
+ */
+#define PyLib_NAME_CACHE_MAX_LENGTH 48
+
+typedef struct PyLib_NameCacheEntry
+{
+    // The number of UTF-16 characters of the name
+    jsize length;
+    // The UTF-16 characters of the name
+    jchar chars[PyLib_NAME_CACHE_MAX_LENGTH];
+    // The interned Python string, NULL if the entry is unused
+    PyObject* pyName;
+}
+PyLib_NameCacheEntry;
+
+/**
+ * A direct-mapped cache of Python attribute names given by Java strings. Only accessed while holding the GIL.
+ */
+static PyLib_NameCacheEntry PyLib_NameCache[PyLib_NAME_CACHE_SIZE];
+
 //#define JPy_JNI_DEBUG 1
 #define JPy_JNI_DEBUG 0
 
@@ -239,25 +297,27 @@ JNIEXPORT jboolean JNICALL Java_org_jpy_PyLib_startPython0
 
 /*
  * Class:     org_jpy_PyLib
- * Method:    stopPython
+ * Method:    stopPython0
  * Signature: ()V
  */
-JNIEXPORT void JNICALL Java_org_jpy_PyLib_stopPython
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_stopPython0
   (JNIEnv* jenv, jclass jLibClass)
 {
-    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_stopPython: entered: JPy_Module=%p\n", JPy_Module);
+    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_stopPython0: entered: JPy_Module=%p\n", JPy_Module);
 
     if (Py_IsInitialized()) {
         // Make sure we can get the GIL if needed before cleaning up.
         PyGILState_STATE state = PyGILState_Ensure();
         // Cleanup the JPY stateful structures and shut the interpreter down.
+        PyLib_ClearNameCache();
         JPy_free();
         Py_Finalize();
         // Make sure we reset our global flag
         JPy_InitThreads = 0;
+        PyLib_Generation++;
     }
 
-    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_stopPython: exiting: JPy_Module=%p\n", JPy_Module);
+    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_stopPython0: exiting: JPy_Module=%p\n", JPy_Module);
 }
 
 
@@ -728,7 +788,7 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
   (JNIEnv* jenv, jclass jLibClass, jlong objId, jstring jName, jobject jValue, jclass jValueClass)
 {
     PyObject* pyObject;
-    const char* nameChars;
+    PyObject* pyName;
     PyObject* pyValue;
     JPy_JType* valueType;
 
@@ -736,8 +796,13 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
 
     pyObject = (PyObject*) objId;
 
-    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
-    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "Java_org_jpy_PyLib_setAttributeValue: objId=%p, name='%s', jValue=%p, jValueClass=%p\n", pyObject, nameChars, jValue, jValueClass);
+    pyName = PyLib_GetPyName(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "Java_org_jpy_PyLib_setAttributeValue: objId=%p, name='%s', jValue=%p, jValueClass=%p\n", pyObject, JPy_AS_UTF8(pyName), jValue, jValueClass);
 
     if (jValueClass != NULL) {
         valueType = JType_GetType(jenv, jValueClass, JNI_FALSE);
@@ -752,19 +817,19 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
     }
 
     if (pyValue == NULL) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: attribute '%s': Java object not convertible\n", nameChars);
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: attribute '%s': Java object not convertible\n", JPy_AS_UTF8(pyName));
         PyLib_HandlePythonException(jenv);
         goto error;
     }
 
-    if (PyObject_SetAttrString(pyObject, nameChars, pyValue) < 0) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: PyObject_SetAttrString failed on attribute '%s'\n", nameChars);
+    if (PyObject_SetAttr(pyObject, pyName, pyValue) < 0) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: PyObject_SetAttr failed on attribute '%s'\n", JPy_AS_UTF8(pyName));
         PyLib_HandlePythonException(jenv);
         goto error;
     }
 
 error:
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    Py_XDECREF(pyName);
 
     JPy_END_GIL_STATE
 }
@@ -829,6 +894,223 @@ error:
 }
 
 
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    internName
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_internName
+  (JNIEnv *jenv, jclass jLibClass, jstring jName)
+{
+    PyObject* pyName;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyName = PyLib_GetPyName(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+    }
+
+    JPy_END_GIL_STATE
+
+    return (jlong) pyName;
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getInternedAttributeObject
+ * Signature: (JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_getInternedAttributeObject
+  (JNIEnv *jenv, jclass jLibClass, jlong objId, jlong nameId)
+{
+    PyObject* pyValue;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyValue = PyLib_GetAttributeObjectWithName(jenv, (PyObject*) objId, (PyObject*) nameId);
+
+    JPy_END_GIL_STATE
+
+    return (jlong) pyValue;
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callInternedAndReturnObject
+ * Signature: (JZJI[Ljava/lang/Object;[Ljava/lang/Class;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_callInternedAndReturnObject
+  (JNIEnv *jenv, jclass jLibClass, jlong objId, jboolean isMethodCall, jlong nameId, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses)
+{
+    PyObject* pyReturnValue;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyReturnValue = PyLib_CallAndReturnObjectWithName(jenv, (PyObject*) objId, isMethodCall, (PyObject*) nameId, argCount, jArgs, jParamClasses);
+
+    JPy_END_GIL_STATE
+
+    return (jlong) pyReturnValue;
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    createCallPlan
+ * Signature: (Ljava/lang/String;[Ljava/lang/Class;Ljava/lang/Class;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_createCallPlan
+  (JNIEnv *jenv, jclass jLibClass, jstring jName, jobjectArray jParamClasses, jclass jReturnClass)
+{
+    PyLib_CallPlan* plan;
+    const char* nameChars;
+    jclass jParamClass;
+    jint i;
+
+    JPy_BEGIN_GIL_STATE
+
+    plan = PyMem_New(PyLib_CallPlan, 1);
+    if (plan == NULL) {
+        PyErr_NoMemory();
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    plan->paramCount = jParamClasses != NULL ? (*jenv)->GetArrayLength(jenv, jParamClasses) : 0;
+    plan->paramClasses = PyMem_New(jclass, plan->paramCount + 1);
+    plan->paramTypes = PyMem_New(JPy_JType*, plan->paramCount + 1);
+    plan->returnClass = jReturnClass != NULL ? (*jenv)->NewGlobalRef(jenv, jReturnClass) : NULL;
+    plan->generation = 0;
+    plan->pyName = NULL;
+    plan->returnType = NULL;
+
+    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
+    plan->nameChars = nameChars != NULL ? JPy_CopyUTFString(nameChars) : NULL;
+    if (nameChars != NULL) {
+        (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    }
+
+    if (plan->paramClasses == NULL || plan->paramTypes == NULL || plan->nameChars == NULL) {
+        PyMem_Del(plan->nameChars);
+        PyMem_Del(plan->paramTypes);
+        PyMem_Del(plan->paramClasses);
+        if (plan->returnClass != NULL) {
+            (*jenv)->DeleteGlobalRef(jenv, plan->returnClass);
+        }
+        PyMem_Del(plan);
+        plan = NULL;
+        PyErr_NoMemory();
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    for (i = 0; i < plan->paramCount; i++) {
+        jParamClass = (*jenv)->GetObjectArrayElement(jenv, jParamClasses, i);
+        plan->paramClasses[i] = jParamClass != NULL ? (*jenv)->NewGlobalRef(jenv, jParamClass) : NULL;
+        plan->paramTypes[i] = NULL;
+        (*jenv)->DeleteLocalRef(jenv, jParamClass);
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "Java_org_jpy_PyLib_createCallPlan: plan=%p, name='%s', paramCount=%d\n", plan, plan->nameChars, plan->paramCount);
+
+error:
+    JPy_END_GIL_STATE
+
+    return (jlong) plan;
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    disposeCallPlan
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_disposeCallPlan
+  (JNIEnv *jenv, jclass jLibClass, jlong planId)
+{
+    PyLib_CallPlan* plan;
+    jint i;
+
+    plan = (PyLib_CallPlan*) planId;
+    if (plan == NULL) {
+        return;
+    }
+
+    JPy_BEGIN_GIL_STATE
+
+    if (plan->generation == PyLib_Generation) {
+        Py_XDECREF(plan->pyName);
+    }
+    for (i = 0; i < plan->paramCount; i++) {
+        if (plan->paramClasses[i] != NULL) {
+            (*jenv)->DeleteGlobalRef(jenv, plan->paramClasses[i]);
+        }
+    }
+    if (plan->returnClass != NULL) {
+        (*jenv)->DeleteGlobalRef(jenv, plan->returnClass);
+    }
+    PyMem_Del(plan->paramTypes);
+    PyMem_Del(plan->paramClasses);
+    PyMem_Del(plan->nameChars);
+    PyMem_Del(plan);
+
+    JPy_END_GIL_STATE
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callPlanAndReturnValue
+ * Signature: (JZJ[Ljava/lang/Object;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callPlanAndReturnValue
+  (JNIEnv *jenv, jclass jLibClass, jlong objId, jboolean isMethodCall, jlong planId, jobjectArray jArgs)
+{
+    PyObject* pyObject;
+    PyObject* pyReturnValue;
+    PyLib_CallPlan* plan;
+    jobject jReturnValue;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyObject = (PyObject*) objId;
+    plan = (PyLib_CallPlan*) planId;
+
+    pyReturnValue = PyLib_CallPlanAndReturnObject(jenv, pyObject, plan, jArgs);
+    if (pyReturnValue == NULL) {
+        jReturnValue = NULL;
+        goto error;
+    }
+
+    jReturnValue = NULL;
+    if (pyReturnValue != Py_None) {
+        if (plan->returnType != NULL) {
+            if (JPy_AsJObjectWithType(jenv, pyReturnValue, &jReturnValue, plan->returnType) < 0) {
+                jReturnValue = NULL;
+            }
+        } else if (JPy_AsJObject(jenv, pyReturnValue, &jReturnValue) < 0) {
+            jReturnValue = NULL;
+        }
+        if (PyErr_Occurred()) {
+            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_callPlanAndReturnValue: error: failed to convert return value of '%s'\n", plan->nameChars);
+            PyLib_HandlePythonException(jenv);
+        } else if (jReturnValue != NULL && JObj_Check(pyReturnValue)) {
+            // jReturnValue is the global reference owned by the wrapped Java object, which may die below
+            jReturnValue = (*jenv)->NewLocalRef(jenv, jReturnValue);
+        }
+    }
+    Py_DECREF(pyReturnValue);
+
+error:
+    JPy_END_GIL_STATE
+
+    return jReturnValue;
+}
+
+
 /*
  * Class:     org_jpy_python_PyLib
  * Method:    getDiagFlags
@@ -855,24 +1137,121 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_00024Diag_setFlags
 // Helpers that also throw Java exceptions
 
 
-PyObject* PyLib_GetAttributeObject(JNIEnv* jenv, PyObject* pyObject, jstring jName)
+/**
+ * Gets the interned Python string for the given Java string. Short names are looked up in the PyLib_NameCache
+ * by their UTF-16 characters, which are copied without UTF conversion and without calling into Java.
+ * Returns a new reference.
+ */
+PyObject* PyLib_GetPyName(JNIEnv* jenv, jstring jName)
 {
-    PyObject* pyValue;
+    PyLib_NameCacheEntry* entry;
+    PyObject* pyName;
     const char* nameChars;
+    jchar chars[PyLib_NAME_CACHE_MAX_LENGTH];
+    jsize length;
+    unsigned int hash;
+    jsize i;
+
+    if (jName == NULL) {
+        PyErr_SetString(PyExc_ValueError, "jpy: attribute name must not be null");
+        return NULL;
+    }
+
+    entry = NULL;
+    length = (*jenv)->GetStringLength(jenv, jName);
+    if (length <= PyLib_NAME_CACHE_MAX_LENGTH) {
+        (*jenv)->GetStringRegion(jenv, jName, 0, length, chars);
+        // FNV-1a
+        hash = 2166136261U;
+        for (i = 0; i < length; i++) {
+            hash = (hash ^ chars[i]) * 16777619U;
+        }
+        entry = &PyLib_NameCache[hash % PyLib_NAME_CACHE_SIZE];
+        if (entry->pyName != NULL && entry->length == length && memcmp(entry->chars, chars, length * sizeof(jchar)) == 0) {
+            Py_INCREF(entry->pyName);
+            return entry->pyName;
+        }
+    }
 
     nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
-    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_GetAttributeObject: objId=%p, name='%s'\n", pyObject, nameChars);
+    if (nameChars == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    pyName = JPy_INTERN_CSTR(nameChars);
+    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    if (pyName == NULL) {
+        return NULL;
+    }
+
+    if (entry != NULL) {
+        Py_XDECREF(entry->pyName);
+        entry->length = length;
+        memcpy(entry->chars, chars, length * sizeof(jchar));
+        entry->pyName = pyName;
+        Py_INCREF(pyName);
+    }
+
+    return pyName;
+}
+
+/**
+ * Clears the PyLib_NameCache. Must be called before the Python interpreter is stopped.
+ */
+void PyLib_ClearNameCache(void)
+{
+    int i;
+
+    for (i = 0; i < PyLib_NAME_CACHE_SIZE; i++) {
+        Py_CLEAR(PyLib_NameCache[i].pyName);
+    }
+}
+
+PyObject* PyLib_GetAttributeObject(JNIEnv* jenv, PyObject* pyObject, jstring jName)
+{
+    PyObject* pyName;
+    PyObject* pyValue;
+
+    pyName = PyLib_GetPyName(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        return NULL;
+    }
+    pyValue = PyLib_GetAttributeObjectWithName(jenv, pyObject, pyName);
+    Py_DECREF(pyName);
+    return pyValue;
+}
+
+PyObject* PyLib_GetAttributeObjectWithName(JNIEnv* jenv, PyObject* pyObject, PyObject* pyName)
+{
+    PyObject* pyValue;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_GetAttributeObject: objId=%p, name='%s'\n", pyObject, JPy_AS_UTF8(pyName));
     /* Note: pyValue is a new reference */
-    pyValue = PyObject_GetAttrString(pyObject, nameChars);
+    pyValue = PyObject_GetAttr(pyObject, pyName);
     if (pyValue == NULL) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_GetAttributeObject: error: attribute not found '%s'\n", nameChars);
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_GetAttributeObject: error: attribute not found '%s'\n", JPy_AS_UTF8(pyName));
         PyLib_HandlePythonException(jenv);
     }
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
     return pyValue;
 }
 
 PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean isMethodCall, jstring jName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses)
+{
+    PyObject* pyName;
+    PyObject* pyReturnValue;
+
+    pyName = PyLib_GetPyName(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        return NULL;
+    }
+    pyReturnValue = PyLib_CallAndReturnObjectWithName(jenv, pyObject, isMethodCall, pyName, argCount, jArgs, jParamClasses);
+    Py_DECREF(pyName);
+    return pyReturnValue;
+}
+
+PyObject* PyLib_CallAndReturnObjectWithName(JNIEnv *jenv, PyObject* pyObject, jboolean isMethodCall, PyObject* pyName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses)
 {
     PyObject* pyCallable;
     PyObject* pyArgs;
@@ -886,14 +1265,14 @@ PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean i
 
     pyReturnValue = NULL;
 
-    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
+    nameChars = JPy_AS_UTF8(pyName);
 
     JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_CallAndReturnObject: objId=%p, isMethodCall=%d, name='%s', argCount=%d\n", pyObject, isMethodCall, nameChars, argCount);
 
     pyArgs = NULL;
 
     // Note: pyCallable is a new reference
-    pyCallable = PyObject_GetAttrString(pyObject, nameChars);
+    pyCallable = PyObject_GetAttr(pyObject, pyName);
     if (pyCallable == NULL) {
         JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: function or method not found: '%s'\n", nameChars);
         PyLib_HandlePythonException(jenv);
@@ -967,7 +1346,131 @@ PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean i
     Py_INCREF(pyReturnValue);
 
 error:
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    Py_XDECREF(pyCallable);
+    Py_XDECREF(pyArgs);
+
+    return pyReturnValue;
+}
+
+/**
+ * Resolves the interned name and the parameter and return types of the given call plan,
+ * if not already done for the running Python interpreter.
+ */
+int PyLib_ResolveCallPlan(JNIEnv *jenv, PyLib_CallPlan* plan)
+{
+    jint i;
+
+    if (plan->generation == PyLib_Generation) {
+        return 0;
+    }
+
+    plan->pyName = JPy_INTERN_CSTR(plan->nameChars);
+    if (plan->pyName == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i < plan->paramCount; i++) {
+        if (plan->paramClasses[i] != NULL) {
+            plan->paramTypes[i] = JType_GetType(jenv, plan->paramClasses[i], JNI_FALSE);
+            if (plan->paramTypes[i] == NULL) {
+                Py_CLEAR(plan->pyName);
+                return -1;
+            }
+        } else {
+            plan->paramTypes[i] = NULL;
+        }
+    }
+
+    if (plan->returnClass != NULL) {
+        plan->returnType = JType_GetType(jenv, plan->returnClass, JNI_FALSE);
+        if (plan->returnType == NULL) {
+            Py_CLEAR(plan->pyName);
+            return -1;
+        }
+    } else {
+        plan->returnType = NULL;
+    }
+
+    plan->generation = PyLib_Generation;
+    return 0;
+}
+
+PyObject* PyLib_CallPlanAndReturnObject(JNIEnv *jenv, PyObject* pyObject, PyLib_CallPlan* plan, jobjectArray jArgs)
+{
+    PyObject* pyCallable;
+    PyObject* pyArgs;
+    PyObject* pyArg;
+    PyObject* pyReturnValue;
+    jint argCount;
+    jint i;
+    jobject jArg;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_CallPlanAndReturnObject: objId=%p, plan=%p, name='%s'\n", pyObject, plan, plan->nameChars);
+
+    pyReturnValue = NULL;
+    pyCallable = NULL;
+    pyArgs = NULL;
+
+    if (PyLib_ResolveCallPlan(jenv, plan) < 0) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallPlanAndReturnObject: error: callable '%s': failed to resolve call plan\n", plan->nameChars);
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    argCount = jArgs != NULL ? (*jenv)->GetArrayLength(jenv, jArgs) : 0;
+    if (argCount != plan->paramCount) {
+        PyErr_Format(PyExc_TypeError, "callable '%s' expects %d argument(s), but got %d", plan->nameChars, plan->paramCount, argCount);
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    // Note: pyCallable is a new reference
+    pyCallable = PyObject_GetAttr(pyObject, plan->pyName);
+    if (pyCallable == NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallPlanAndReturnObject: error: function or method not found: '%s'\n", plan->nameChars);
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    if (!PyCallable_Check(pyCallable)) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallPlanAndReturnObject: error: object is not callable: '%s'\n", plan->nameChars);
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    pyArgs = PyTuple_New(argCount);
+    if (pyArgs == NULL) {
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+    for (i = 0; i < argCount; i++) {
+        jArg = (*jenv)->GetObjectArrayElement(jenv, jArgs, i);
+        if (plan->paramTypes[i] != NULL) {
+            pyArg = JPy_FromJObjectWithType(jenv, jArg, plan->paramTypes[i]);
+        } else {
+            pyArg = JPy_FromJObject(jenv, jArg);
+        }
+        (*jenv)->DeleteLocalRef(jenv, jArg);
+
+        if (pyArg == NULL) {
+            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallPlanAndReturnObject: error: callable '%s': argument %d: failed to convert Java into Python object\n", plan->nameChars, i);
+            PyLib_HandlePythonException(jenv);
+            goto error;
+        }
+
+        // pyArg reference stolen here
+        PyTuple_SET_ITEM(pyArgs, i, pyArg);
+    }
+
+    pyReturnValue = PyObject_CallObject(pyCallable, argCount > 0 ? pyArgs : NULL);
+    if (pyReturnValue == NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallPlanAndReturnObject: error: callable '%s': call returned NULL\n", plan->nameChars);
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+
+error:
     Py_XDECREF(pyCallable);
     Py_XDECREF(pyArgs);
 
@@ -33,10 +33,10 @@ JNIEXPORT jstring JNICALL Java_org_jpy_PyLib_getPythonVersion
 
 /*
  * Class:     org_jpy_PyLib
- * Method:    stopPython
+ * Method:    stopPython0
  * Signature: ()V
  */
-JNIEXPORT void JNICALL Java_org_jpy_PyLib_stopPython
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_stopPython0
   (JNIEnv *, jclass);
 
 /*
@@ -159,6 +159,54 @@ JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_callAndReturnObject
 JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callAndReturnValue
   (JNIEnv *, jclass, jlong, jboolean, jstring, jint, jobjectArray, jobjectArray, jclass);
 
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    internName
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_internName
+  (JNIEnv *, jclass, jstring);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getInternedAttributeObject
+ * Signature: (JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_getInternedAttributeObject
+  (JNIEnv *, jclass, jlong, jlong);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callInternedAndReturnObject
+ * Signature: (JZJI[Ljava/lang/Object;[Ljava/lang/Class;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_callInternedAndReturnObject
+  (JNIEnv *, jclass, jlong, jboolean, jlong, jint, jobjectArray, jobjectArray);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    createCallPlan
+ * Signature: (Ljava/lang/String;[Ljava/lang/Class;Ljava/lang/Class;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_createCallPlan
+  (JNIEnv *, jclass, jstring, jobjectArray, jclass);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    disposeCallPlan
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_disposeCallPlan
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callPlanAndReturnValue
+ * Signature: (JZJ[Ljava/lang/Object;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callPlanAndReturnValue
+  (JNIEnv *, jclass, jlong, jboolean, jlong, jobjectArray);
+
 #ifdef __cplusplus
 }
 #endif
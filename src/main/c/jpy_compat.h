@@ -45,6 +45,7 @@ extern "C" {
 
 #define JPy_IS_STR(pyArg)        PyUnicode_Check(pyArg)
 #define JPy_FROM_CSTR(cstr)      PyUnicode_FromString(cstr)
+#define JPy_INTERN_CSTR(cstr)    PyUnicode_InternFromString(cstr)
 #define JPy_FROM_FORMAT          PyUnicode_FromFormat
 
 #define JPy_AS_UTF8(unicode)                 PyUnicode_AsUTF8(unicode)
@@ -60,6 +61,7 @@ extern "C" {
 
 #define JPy_IS_STR(pyArg)        (PyString_Check(pyArg) || PyUnicode_Check(pyArg))
 #define JPy_FROM_CSTR(cstr)      PyString_FromString(cstr)
+#define JPy_INTERN_CSTR(cstr)    PyString_InternFromString(cstr)
 #define JPy_FROM_FORMAT          PyString_FromFormat
 
 // Implement conversion rules from Python 2 to 3 as given here:
@@ -76,6 +78,69 @@ wchar_t* JPy_AsWideCharString_PriorToPy33(PyObject *unicode, Py_ssize_t *size);
 #endif
 
 
+// Storage class for thread-local variables
+//
+#if defined(_MSC_VER)
+#define JPY_THREAD_LOCAL __declspec(thread)
+#else
+#define JPY_THREAD_LOCAL __thread
+#endif
+
+
+// The vectorcall protocol (PEP 590), used for calling Java methods and constructors without creating
+// argument tuples. Its public API is only available since Python 3.9.
+//
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x03090000
+#define JPY_VECTORCALL 1
+#endif
+
+
+// PyBufferProcs 3.x
+//
+// struct PyBufferProcs {
+//    getbufferproc bf_getbuffer;
+//    releasebufferproc bf_releasebuffer;
+// }
+//
+// PyBufferProcs 2.6 and 2.7 (3.x backport)
+//
+// struct PyBufferProcs {
+//    readbufferproc bf_getreadbuffer;
+//    writebufferproc bf_getwritebuffer;
+//    segcountproc bf_getsegcount;
+//    charbufferproc bf_getcharbuffer;
+//    getbufferproc bf_getbuffer;
+//    releasebufferproc bf_releasebuffer;
+// }
+//
+// PyBufferProcs <= 2.5 (not supported by jpy)
+//
+// struct PyBufferProcs {
+//    readbufferproc bf_getreadbuffer;
+//    writebufferproc bf_getwritebuffer;
+//    segcountproc bf_getsegcount;
+//    charbufferproc bf_getcharbuffer;
+// }
+
+#if defined(JPY_COMPAT_33P)
+
+#define JPY_PY27_OLD_BUFFER_PROCS
+
+#elif defined(JPY_COMPAT_27)
+
+#define JPY_PY27_OLD_BUFFER_PROCS \
+    (readbufferproc) NULL, \
+    (writebufferproc) NULL, \
+    (segcountproc) NULL, \
+    (charbufferproc) NULL,
+
+#else
+
+#error JPY_VERSION_ERROR
+
+#endif
+
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
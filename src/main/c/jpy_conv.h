@@ -112,6 +112,12 @@ PyObject* JPy_FromTypeName(JNIEnv* jenv, jclass classRef);
  */
 char* JPy_GetTypeName(JNIEnv* jenv, jclass classRef);
 
+/**
+ * Copies the UTF, zero-terminated C-string.
+ * Caller is responsible for freeing the returned string using PyMem_Del().
+ */
+char* JPy_CopyUTFString(const char* utfChars);
+
 
 #ifdef __cplusplus
 }  /* extern "C" */
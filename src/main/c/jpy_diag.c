@@ -21,6 +21,12 @@
 
 int JPy_DiagFlags = JPy_DIAG_F_OFF;
 
+// The number of JNI local reference frames currently pushed by Python-to-Java entry points on this thread,
+// see JPy_BEGIN_LOCAL_FRAME and JPy_END_LOCAL_FRAME. This only checks that frames are balanced: a non-zero value seen
+// from top-level Python code reveals a frame that has not been popped, while Python code called back from Java sees
+// the frames of the calls in progress.
+JPY_THREAD_LOCAL Py_ssize_t JPy_DiagLocalFrameCount = 0;
+
 
 void JPy_DiagPrint(int diagFlags, const char * format, ...)
 {
@@ -48,6 +54,7 @@ PyObject* Diag_New(void)
     self->F_JVM   = JPy_DIAG_F_JVM;
     self->F_ERR   = JPy_DIAG_F_ERR;
     self->F_ALL   = JPy_DIAG_F_ALL;
+    self->local_frames = 0;
 
     return (PyObject*) self;
 }
@@ -58,6 +65,8 @@ PyObject* Diag_getattro(JPy_Diag* self, PyObject *attr_name)
     //printf("Diag_getattro: attr_name=%s\n", JPy_AS_UTF8(attr_name));
     if (strcmp(JPy_AS_UTF8(attr_name), "flags") == 0) {
         return JPy_FROM_CLONG(JPy_DiagFlags);
+    } else if (strcmp(JPy_AS_UTF8(attr_name), "local_frames") == 0) {
+        return PyLong_FromSsize_t(JPy_DiagLocalFrameCount);
     } else {
         return PyObject_GenericGetAttr((PyObject*) self, attr_name);
     }
@@ -92,6 +101,7 @@ static PyMemberDef Diag_members[] =
     {"F_JVM",    T_INT, offsetof(JPy_Diag, F_JVM),   READONLY, "JVM: print diagnostic information usage of the Java VM Invocation API"},
     {"F_ERR",    T_INT, offsetof(JPy_Diag, F_ERR),   READONLY, "Errors: print diagnostic information when erroneous states are detected"},
     {"F_ALL",    T_INT, offsetof(JPy_Diag, F_ALL),   READONLY, "Print any diagnostic messages"},
+    {"local_frames", T_PYSSIZET, offsetof(JPy_Diag, local_frames), READONLY, "Number of JNI local reference frames currently pushed by calls from Python into Java on the current thread (frame balance check)"},
     {NULL}  /* Sentinel */
 };
 
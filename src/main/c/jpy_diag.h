@@ -35,6 +35,7 @@ typedef struct JPy_Diag
     int F_JVM;
     int F_ERR;
     int F_ALL;
+    Py_ssize_t local_frames;
 }
 JPy_Diag;
 
@@ -50,6 +51,7 @@ JPy_Diag;
 
 extern PyTypeObject Diag_Type;
 extern int JPy_DiagFlags;
+extern JPY_THREAD_LOCAL Py_ssize_t JPy_DiagLocalFrameCount;
 
 PyObject* Diag_New(void);
 
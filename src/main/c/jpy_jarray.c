@@ -22,7 +22,20 @@
 #define PRINT_FLAG(F) printf("JArray_GetBufferProc: %s = %d\n", #F, (flags & F) != 0);
 #define PRINT_MEMB(F, M) printf("JArray_GetBufferProc: %s = " ## F ## "\n", #M, M);
 
-//#define JPy_USE_GET_PRIMITIVE_ARRAY_CRITICAL 1
+// Marks buffers exported in critical mode, referred to by Py_buffer.internal
+static char JArray_CriticalExport;
+
+
+PyObject* JArray_NewCriticalView(JPy_JArray* self)
+{
+    PyObject* view;
+
+    self->exportCritical = JNI_TRUE;
+    view = PyMemoryView_FromObject((PyObject*) self);
+    self->exportCritical = JNI_FALSE;
+
+    return view;
+}
 
 
 /*
@@ -35,10 +48,15 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
     JNIEnv* jenv;
     jint itemCount;
     jboolean isCopy;
+    jboolean isCritical;
     void* buf;
 
+    // Also refuses to open a critical view while another one is in use, since no JNI calls,
+    // including GetArrayLength() below, are allowed then
     JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
 
+    isCritical = self->exportCritical;
+
     /*
     printf("JArray_GetBufferProc:\n");
     PRINT_FLAG(PyBUF_ANY_CONTIGUOUS);
@@ -68,10 +86,10 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
     // buffer allocation shall be done in the 5 following steps;
 
     // Step 1/5
-#ifdef JPy_USE_GET_PRIMITIVE_ARRAY_CRITICAL
-    buf = (*jenv)->GetPrimitiveArrayCritical(jenv, self->objectRef, &isCopy);
-#else
-    if (javaType == 'Z') {
+    if (isCritical) {
+        // From here on, no JNI calls must be made until the buffer is released, see JPy_GET_JNI_ENV_OR_RETURN
+        buf = (*jenv)->GetPrimitiveArrayCritical(jenv, self->objectRef, &isCopy);
+    } else if (javaType == 'Z') {
         buf = (*jenv)->GetBooleanArrayElements(jenv, self->objectRef, &isCopy);
     } else if (javaType == 'C') {
         buf = (*jenv)->GetCharArrayElements(jenv, self->objectRef, &isCopy);
@@ -91,19 +109,19 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
         PyErr_Format(PyExc_RuntimeError, "internal error: illegal Java array type '%c'", javaType);
         return -1;
     }
-#endif
     if (buf == NULL) {
         PyErr_NoMemory();
         return -1;
     }
 
-    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_GetBufferProc: buf=%p, type='%s', format='%s', itemSize=%d, itemCount=%d, isCopy=%d\n", buf, Py_TYPE(self)->tp_name, format, itemSize, itemCount, isCopy);
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_GetBufferProc: buf=%p, type='%s', format='%s', itemSize=%d, itemCount=%d, isCopy=%d, isCritical=%d\n", buf, Py_TYPE(self)->tp_name, format, itemSize, itemCount, isCopy, isCritical);
 
     // Step 2/5
     view->buf = buf;
     view->len = itemCount * itemSize;
     view->itemsize = itemSize;
-    view->readonly = (flags & (PyBUF_WRITE | PyBUF_WRITEABLE)) == 0;
+    // Critical views always write through to the Java array
+    view->readonly = !isCritical && (flags & (PyBUF_WRITE | PyBUF_WRITEABLE)) == 0;
     view->ndim = 1;
     view->shape = PyMem_New(Py_ssize_t, 1);
     *view->shape = itemCount;
@@ -127,7 +145,13 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
     */
 
     // Step 3/5
-    self->bufferExportCount++;
+    if (isCritical) {
+        view->internal = &JArray_CriticalExport;
+        JPy_CriticalBufferCount++;
+    } else {
+        view->internal = NULL;
+        self->bufferExportCount++;
+    }
 
     // Step 4/5
     view->obj = (PyObject*) self;
@@ -183,6 +207,24 @@ int JArray_getbufferproc_double(JPy_JArray* self, Py_buffer* view, int flags)
  */
 void JArray_ReleaseBufferProc(JPy_JArray* self, Py_buffer* view, char javaType)
 {
+    JNIEnv* jenv;
+
+    if (view->internal == &JArray_CriticalExport) {
+        // The view should be released by the thread that created it, e.g. by leaving its 'with' block
+        JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_ReleaseBufferProc: buf=%p, critical\n", view->buf);
+        jenv = JPy_GetReleaseJNIEnv();
+        if (jenv != NULL) {
+            (*jenv)->ReleasePrimitiveArrayCritical(jenv, self->objectRef, view->buf, 0);
+        }
+        view->buf = NULL;
+        view->internal = NULL;
+        JPy_CriticalBufferCount--;
+        if (jenv != NULL) {
+            JPy_ReleaseDeferred(jenv);
+        }
+        return;
+    }
+
     // Step 1
     self->bufferExportCount--;
 
@@ -190,30 +232,8 @@ void JArray_ReleaseBufferProc(JPy_JArray* self, Py_buffer* view, char javaType)
 
     // Step 2
     if (self->bufferExportCount == 0 && view->buf != NULL) {
-        JNIEnv* jenv = JPy_GetJNIEnv();
-        if (jenv != NULL) {
-#ifdef JPy_USE_GET_PRIMITIVE_ARRAY_CRITICAL
-           (*jenv)->ReleasePrimitiveArrayCritical(jenv, self->objectRef, view->buf, 0);
-#else
-            if (javaType == 'Z') {
-                (*jenv)->ReleaseBooleanArrayElements(jenv, self->objectRef, (jboolean*) view->buf, 0);
-            } else if (javaType == 'C') {
-                (*jenv)->ReleaseCharArrayElements(jenv, self->objectRef, (jchar*) view->buf, 0);
-            } else if (javaType == 'B') {
-                (*jenv)->ReleaseByteArrayElements(jenv, self->objectRef, (jbyte*) view->buf, 0);
-            } else if (javaType == 'S') {
-                (*jenv)->ReleaseShortArrayElements(jenv, self->objectRef, (jshort*) view->buf, 0);
-            } else if (javaType == 'I') {
-                (*jenv)->ReleaseIntArrayElements(jenv, self->objectRef, (jint*) view->buf, 0);
-            } else if (javaType == 'J') {
-                (*jenv)->ReleaseLongArrayElements(jenv, self->objectRef, (jlong*) view->buf, 0);
-            } else if (javaType == 'F') {
-                (*jenv)->ReleaseFloatArrayElements(jenv, self->objectRef, (jfloat*) view->buf, 0);
-            } else if (javaType == 'D') {
-                (*jenv)->ReleaseDoubleArrayElements(jenv, self->objectRef, (jdouble*) view->buf, 0);
-            }
-#endif
-        }
+        // Deferred while a critical view of another array is in use
+        JPy_ReleaseArrayElements(JPy_GetReleaseJNIEnv(), self->objectRef, view->buf, javaType);
         view->buf = NULL;
     }
 
@@ -263,52 +283,6 @@ void JArray_releasebufferproc_double(JPy_JArray* self, Py_buffer* view)
     JArray_ReleaseBufferProc(self, view, 'D');
 }
 
-// PyBufferProcs 3.x
-//
-// struct PyBufferProcs {
-//    getbufferproc bf_getbuffer;
-//    releasebufferproc bf_releasebuffer;
-// }
-//
-// PyBufferProcs 2.6 and 2.7 (3.x backport)
-//
-// struct PyBufferProcs {
-//    readbufferproc bf_getreadbuffer;
-//    writebufferproc bf_getwritebuffer;
-//    segcountproc bf_getsegcount;
-//    charbufferproc bf_getcharbuffer;
-//    getbufferproc bf_getbuffer;
-//    releasebufferproc bf_releasebuffer;
-// }
-//
-// PyBufferProcs <= 2.5 (not supported by jpy)
-//
-// struct PyBufferProcs {
-//    readbufferproc bf_getreadbuffer;
-//    writebufferproc bf_getwritebuffer;
-//    segcountproc bf_getsegcount;
-//    charbufferproc bf_getcharbuffer;
-// }
-
-#if defined(JPY_COMPAT_33P)
-
-#define JPY_PY27_OLD_BUFFER_PROCS
-
-#elif defined(JPY_COMPAT_27)
-
-#define JPY_PY27_OLD_BUFFER_PROCS \
-    (readbufferproc) NULL, \
-    (writebufferproc) NULL, \
-    (segcountproc) NULL, \
-    (charbufferproc) NULL,
-
-#else
-
-#error JPY_VERSION_ERROR
-
-#endif
-
-
 PyBufferProcs JArray_as_buffer_boolean = {
     JPY_PY27_OLD_BUFFER_PROCS
     (getbufferproc) JArray_getbufferproc_boolean,
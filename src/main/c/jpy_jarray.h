@@ -26,18 +26,28 @@ extern "C" {
 /**
  * The Java primitive array representation in Python.
  *
- * IMPORTANT: JPy_JArray must only differ from the JPy_JObj structure by the 'bufferExportCount' member
- * since we use the same basic type, name JPy_JType for it. DON'T ever change member positions!
+ * IMPORTANT: JPy_JArray must only differ from the JPy_JObj structure by the 'bufferExportCount' and
+ * 'exportCritical' members since we use the same basic type, name JPy_JType for it. DON'T ever change member positions!
  * @see JPy_JObj
  */
 typedef struct JPy_JArray
 {
     PyObject_HEAD
     jobject objectRef;
+    // The number of buffers exported in copy mode
     jint bufferExportCount;
+    // If true, the next buffer is exported in critical mode, see JArray_NewCriticalView()
+    jboolean exportCritical;
 }
 JPy_JArray;
 
+/**
+ * Returns a new memoryview that directly accesses the array elements obtained by GetPrimitiveArrayCritical().
+ * While the view is in use, JPy_CriticalBufferCount is non-zero and no Java calls can be made by any thread,
+ * including opening another critical view. Global references are deleted once the view is released.
+ */
+PyObject* JArray_NewCriticalView(JPy_JArray* self);
+
 extern PyBufferProcs JArray_as_buffer_boolean;
 extern PyBufferProcs JArray_as_buffer_char;
 extern PyBufferProcs JArray_as_buffer_byte;
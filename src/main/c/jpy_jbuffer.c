@@ -0,0 +1,392 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "jpy_module.h"
+#include "jpy_diag.h"
+#include "jpy_jtype.h"
+#include "jpy_jobj.h"
+#include "jpy_jbuffer.h"
+#include "jpy_conv.h"
+
+
+/**
+ * Describes the items of a typed Java NIO buffer class.
+ * Formats refer to the Python 'struct' module documentation.
+ */
+typedef struct JBuffer_ItemType
+{
+    const char* javaName;
+    Py_ssize_t itemSize;
+    const char* nativeFormat;
+    const char* littleEndianFormat;
+    const char* bigEndianFormat;
+}
+JBuffer_ItemType;
+
+static const JBuffer_ItemType JBuffer_ItemTypes[] = {
+    {"java.nio.ByteBuffer",   1, "b", "b",  "b"},
+    {"java.nio.CharBuffer",   2, "H", "<H", ">H"},
+    {"java.nio.ShortBuffer",  2, "h", "<h", ">h"},
+    {"java.nio.IntBuffer",    4, "i", "<i", ">i"},
+    {"java.nio.LongBuffer",   8, "q", "<q", ">q"},
+    {"java.nio.FloatBuffer",  4, "f", "<f", ">f"},
+    {"java.nio.DoubleBuffer", 8, "d", "<d", ">d"},
+    {NULL, 0, NULL, NULL, NULL}
+};
+
+// Maps the addresses of the Python objects returned by jpy.direct_buffer() to capsules of the exported Python buffers
+static PyObject* JBuffer_Exports = NULL;
+
+
+jboolean JBuffer_IsBufferType(JPy_JType* type)
+{
+    while (type != NULL) {
+        if (strcmp(type->javaName, "java.nio.Buffer") == 0) {
+            return JNI_TRUE;
+        }
+        type = type->superType;
+    }
+    return JNI_FALSE;
+}
+
+/**
+ * Finds the typed NIO buffer class of the given type, e.g. 'java.nio.IntBuffer' for 'java.nio.DirectIntBufferU'.
+ * Returns NULL if there is none.
+ */
+static const JBuffer_ItemType* JBuffer_GetItemType(JPy_JType* type, JPy_JType** bufferType)
+{
+    const JBuffer_ItemType* itemType;
+
+    while (type != NULL) {
+        for (itemType = JBuffer_ItemTypes; itemType->javaName != NULL; itemType++) {
+            if (strcmp(type->javaName, itemType->javaName) == 0) {
+                *bufferType = type;
+                return itemType;
+            }
+        }
+        type = type->superType;
+    }
+    return NULL;
+}
+
+/**
+ * Returns a new local reference to ByteOrder.nativeOrder().
+ */
+static jobject JBuffer_GetNativeOrder(JNIEnv* jenv)
+{
+    jclass byteOrderClassRef;
+    jmethodID mid;
+    jobject nativeOrder;
+
+    byteOrderClassRef = (*jenv)->FindClass(jenv, "java/nio/ByteOrder");
+    if (byteOrderClassRef == NULL) {
+        JPy_HandleJavaException(jenv);
+        return NULL;
+    }
+    mid = (*jenv)->GetStaticMethodID(jenv, byteOrderClassRef, "nativeOrder", "()Ljava/nio/ByteOrder;");
+    nativeOrder = mid != NULL ? (*jenv)->CallStaticObjectMethod(jenv, byteOrderClassRef, mid) : NULL;
+    (*jenv)->DeleteLocalRef(jenv, byteOrderClassRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return nativeOrder;
+}
+
+/**
+ * Gets the struct module format of the items of a typed NIO buffer by calling its order() method.
+ */
+static const char* JBuffer_GetFormat(JNIEnv* jenv, jobject objectRef, jclass bufferClassRef, const JBuffer_ItemType* itemType)
+{
+    static const int one = 1;
+    jmethodID mid;
+    jobject byteOrder;
+    jobject nativeOrder;
+    jboolean isNativeOrder;
+
+    if (itemType->itemSize == 1) {
+        return itemType->nativeFormat;
+    }
+
+    mid = (*jenv)->GetMethodID(jenv, bufferClassRef, "order", "()Ljava/nio/ByteOrder;");
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    byteOrder = (*jenv)->CallObjectMethod(jenv, objectRef, mid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+
+    nativeOrder = JBuffer_GetNativeOrder(jenv);
+    if (nativeOrder == NULL) {
+        (*jenv)->DeleteLocalRef(jenv, byteOrder);
+        return NULL;
+    }
+
+    isNativeOrder = (*jenv)->IsSameObject(jenv, byteOrder, nativeOrder);
+    (*jenv)->DeleteLocalRef(jenv, nativeOrder);
+    (*jenv)->DeleteLocalRef(jenv, byteOrder);
+
+    if (isNativeOrder) {
+        return itemType->nativeFormat;
+    }
+    // Swapped byte order: big endian on little endian hosts and vice versa
+    return *((const char*) &one) == 1 ? itemType->bigEndianFormat : itemType->littleEndianFormat;
+}
+
+/*
+ * Implements the getbuffer() method of the buffer protocol for direct Java NIO buffers.
+ * The view covers the buffer's whole capacity, independent of its current position and limit.
+ */
+int JBuffer_getbufferproc(JPy_JObj* self, Py_buffer* view, int flags)
+{
+    JNIEnv* jenv;
+    const JBuffer_ItemType* itemType;
+    JPy_JType* bufferType;
+    void* buf;
+    jlong capacity;
+    jmethodID mid;
+    jboolean readOnly;
+    const char* format;
+    Py_ssize_t* shapeAndStrides;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    itemType = JBuffer_GetItemType((JPy_JType*) Py_TYPE(self), &bufferType);
+    if (itemType == NULL) {
+        PyErr_Format(PyExc_BufferError, "Java buffer type '%s' does not support the buffer protocol", Py_TYPE(self)->tp_name);
+        return -1;
+    }
+
+    buf = (*jenv)->GetDirectBufferAddress(jenv, self->objectRef);
+    capacity = (*jenv)->GetDirectBufferCapacity(jenv, self->objectRef);
+    if (buf == NULL || capacity < 0) {
+        PyErr_SetString(PyExc_BufferError, "only direct Java buffers support the buffer protocol");
+        return -1;
+    }
+
+    mid = (*jenv)->GetMethodID(jenv, bufferType->classRef, "isReadOnly", "()Z");
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    readOnly = (*jenv)->CallBooleanMethod(jenv, self->objectRef, mid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (readOnly && (flags & PyBUF_WRITABLE) != 0) {
+        PyErr_SetString(PyExc_BufferError, "Java buffer is read-only");
+        return -1;
+    }
+
+    format = JBuffer_GetFormat(jenv, self->objectRef, bufferType->classRef, itemType);
+    if (format == NULL) {
+        return -1;
+    }
+
+    // Shape and strides are released in JBuffer_releasebufferproc()
+    shapeAndStrides = PyMem_New(Py_ssize_t, 2);
+    if (shapeAndStrides == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    shapeAndStrides[0] = (Py_ssize_t) capacity;
+    shapeAndStrides[1] = itemType->itemSize;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JBuffer_getbufferproc: buf=%p, type='%s', capacity=%ld, readOnly=%d, format='%s'\n", buf, Py_TYPE(self)->tp_name, (long) capacity, readOnly, format);
+
+    view->buf = buf;
+    view->len = (Py_ssize_t) capacity * itemType->itemSize;
+    view->itemsize = itemType->itemSize;
+    view->readonly = readOnly;
+    view->ndim = 1;
+    view->shape = shapeAndStrides;
+    view->strides = shapeAndStrides + 1;
+    view->suboffsets = NULL;
+    view->internal = shapeAndStrides;
+    if ((flags & PyBUF_FORMAT) != 0) {
+        view->format = (char*) format;
+    } else {
+        view->format = NULL;
+    }
+
+    view->obj = (PyObject*) self;
+    Py_INCREF(view->obj);
+
+    return 0;
+}
+
+/*
+ * Implements the releasebuffer() method of the buffer protocol for direct Java NIO buffers.
+ */
+void JBuffer_releasebufferproc(JPy_JObj* self, Py_buffer* view)
+{
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JBuffer_releasebufferproc: buf=%p\n", view->buf);
+
+    PyMem_Del(view->internal);
+    view->internal = NULL;
+}
+
+PyBufferProcs JBuffer_as_buffer = {
+    JPY_PY27_OLD_BUFFER_PROCS
+    (getbufferproc) JBuffer_getbufferproc,
+    (releasebufferproc) JBuffer_releasebufferproc
+};
+
+
+static void JBuffer_DisposeExport(PyObject* capsule)
+{
+    Py_buffer* pyBuffer;
+
+    pyBuffer = (Py_buffer*) PyCapsule_GetPointer(capsule, NULL);
+    if (pyBuffer != NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JBuffer_DisposeExport: releasing Python buffer: buf=%p\n", pyBuffer->buf);
+        PyBuffer_Release(pyBuffer);
+        PyMem_Del(pyBuffer);
+    }
+}
+
+/**
+ * Calls the given method of a java.nio.ByteBuffer and replaces the buffer by the returned buffer.
+ */
+static int JBuffer_CallByteBufferMethod(JNIEnv* jenv, jobject* byteBuffer, const char* name, const char* sig, jobject arg)
+{
+    jclass classRef;
+    jmethodID mid;
+    jobject result;
+
+    classRef = (*jenv)->GetObjectClass(jenv, *byteBuffer);
+    mid = (*jenv)->GetMethodID(jenv, classRef, name, sig);
+    (*jenv)->DeleteLocalRef(jenv, classRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+
+    result = arg != NULL ? (*jenv)->CallObjectMethod(jenv, *byteBuffer, mid, arg) : (*jenv)->CallObjectMethod(jenv, *byteBuffer, mid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+
+    (*jenv)->DeleteLocalRef(jenv, *byteBuffer);
+    *byteBuffer = result;
+    return 0;
+}
+
+/**
+ * Sets the byte order of the given java.nio.ByteBuffer to ByteOrder.nativeOrder().
+ */
+static int JBuffer_SetNativeOrder(JNIEnv* jenv, jobject* byteBuffer)
+{
+    jobject nativeOrder;
+    int result;
+
+    nativeOrder = JBuffer_GetNativeOrder(jenv);
+    if (nativeOrder == NULL) {
+        return -1;
+    }
+
+    result = JBuffer_CallByteBufferMethod(jenv, byteBuffer, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;", nativeOrder);
+    (*jenv)->DeleteLocalRef(jenv, nativeOrder);
+    return result;
+}
+
+PyObject* JBuffer_NewDirectBuffer(JNIEnv* jenv, PyObject* pyObj)
+{
+    Py_buffer* pyBuffer;
+    jobject byteBuffer;
+    PyObject* capsule;
+    PyObject* key;
+    PyObject* result;
+
+    pyBuffer = PyMem_New(Py_buffer, 1);
+    if (pyBuffer == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(pyObj, pyBuffer, PyBUF_ANY_CONTIGUOUS | PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        if (PyObject_GetBuffer(pyObj, pyBuffer, PyBUF_ANY_CONTIGUOUS) < 0) {
+            PyMem_Del(pyBuffer);
+            return NULL;
+        }
+    }
+
+    // From here on, the capsule owns the Python buffer
+    capsule = PyCapsule_New(pyBuffer, NULL, JBuffer_DisposeExport);
+    if (capsule == NULL) {
+        PyBuffer_Release(pyBuffer);
+        PyMem_Del(pyBuffer);
+        return NULL;
+    }
+
+    byteBuffer = (*jenv)->NewDirectByteBuffer(jenv, pyBuffer->buf, (jlong) pyBuffer->len);
+    if (byteBuffer == NULL) {
+        Py_DECREF(capsule);
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            JPy_HandleJavaException(jenv);
+        } else {
+            PyErr_SetString(PyExc_RuntimeError, "jpy: the Java VM does not support direct buffer access");
+        }
+        return NULL;
+    }
+
+    if ((pyBuffer->readonly && JBuffer_CallByteBufferMethod(jenv, &byteBuffer, "asReadOnlyBuffer", "()Ljava/nio/ByteBuffer;", NULL) < 0)
+        || JBuffer_SetNativeOrder(jenv, &byteBuffer) < 0) {
+        (*jenv)->DeleteLocalRef(jenv, byteBuffer);
+        Py_DECREF(capsule);
+        return NULL;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JBuffer_NewDirectBuffer: buf=%p, len=%ld, readonly=%d\n", pyBuffer->buf, (long) pyBuffer->len, pyBuffer->readonly);
+
+    result = JPy_FromJObject(jenv, byteBuffer);
+    (*jenv)->DeleteLocalRef(jenv, byteBuffer);
+    if (result == NULL) {
+        Py_DECREF(capsule);
+        return NULL;
+    }
+
+    if (JBuffer_Exports == NULL) {
+        JBuffer_Exports = PyDict_New();
+        if (JBuffer_Exports == NULL) {
+            Py_DECREF(result);
+            Py_DECREF(capsule);
+            return NULL;
+        }
+    }
+
+    key = PyLong_FromVoidPtr(result);
+    if (key == NULL || PyDict_SetItem(JBuffer_Exports, key, capsule) < 0) {
+        Py_XDECREF(key);
+        Py_DECREF(result);
+        Py_DECREF(capsule);
+        return NULL;
+    }
+
+    Py_DECREF(key);
+    Py_DECREF(capsule);
+    return result;
+}
+
+void JBuffer_ReleaseDirectBuffer(PyObject* obj)
+{
+    PyObject* key;
+    PyObject* type;
+    PyObject* value;
+    PyObject* traceback;
+
+    if (JBuffer_Exports == NULL || PyDict_Size(JBuffer_Exports) == 0) {
+        return;
+    }
+
+    // We may be called during exception handling, so save the current exception
+    PyErr_Fetch(&type, &value, &traceback);
+    key = PyLong_FromVoidPtr(obj);
+    if (key != NULL) {
+        if (PyDict_GetItem(JBuffer_Exports, key) != NULL) {
+            PyDict_DelItem(JBuffer_Exports, key);
+        }
+        Py_DECREF(key);
+    }
+    PyErr_Clear();
+    PyErr_Restore(type, value, traceback);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JPY_JBUFFER_H
+#define JPY_JBUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jpy_compat.h"
+
+/**
+ * The buffer protocol implementation for direct Java NIO buffers, i.e. instances of 'java.nio.Buffer'
+ * whose memory has been allocated outside the Java heap.
+ */
+extern PyBufferProcs JBuffer_as_buffer;
+
+/**
+ * Returns true, if the given type is 'java.nio.Buffer' or one of its subclasses.
+ */
+jboolean JBuffer_IsBufferType(struct JPy_JType* type);
+
+/**
+ * Returns a new 'java.nio.ByteBuffer' which directly accesses the memory of the given Python buffer object.
+ * The Python buffer is released when the returned Python object is deallocated.
+ */
+PyObject* JBuffer_NewDirectBuffer(JNIEnv* jenv, PyObject* pyObj);
+
+/**
+ * Releases the Python buffer wrapped by the given object, if it has been returned by JBuffer_NewDirectBuffer().
+ * Called from JObj_dealloc().
+ */
+void JBuffer_ReleaseDirectBuffer(PyObject* obj);
+
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* !JPY_JBUFFER_H */
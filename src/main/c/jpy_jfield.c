@@ -23,32 +23,149 @@
 #include "jpy_compat.h"
 
 
-JPy_JField* JField_New(JPy_JType* declaringClass, PyObject* fieldName, JPy_JType* fieldType, jboolean isStatic, jboolean isFinal, jfieldID fid)
+/**
+ * Defines the get and set functions for Java fields of the primitive type NAME.
+ * Function pointers to these are assigned to JPy_JField.GetFieldValue/SetFieldValue by JField_ResolveType().
+ */
+#define JField_DEFINE_PRIMITIVE_ACCESSORS(NAME, JTYPE, FROM_JTYPE, AS_JTYPE) \
+PyObject* JField_Get##NAME##Value(JNIEnv* jenv, JPy_JField* field, jobject objectRef) \
+{ \
+    JTYPE item = (*jenv)->Get##NAME##Field(jenv, objectRef, field->fid); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL); \
+    return FROM_JTYPE(item); \
+} \
+int JField_Set##NAME##Value(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* pyValue) \
+{ \
+    JTYPE item = AS_JTYPE(pyValue); \
+    (*jenv)->Set##NAME##Field(jenv, objectRef, field->fid, item); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1); \
+    return 0; \
+}
+
+JField_DEFINE_PRIMITIVE_ACCESSORS(Boolean, jboolean, JPy_FROM_JBOOLEAN, JPy_AS_JBOOLEAN)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Char, jchar, JPy_FROM_JCHAR, JPy_AS_JCHAR)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Byte, jbyte, JPy_FROM_JBYTE, JPy_AS_JBYTE)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Short, jshort, JPy_FROM_JSHORT, JPy_AS_JSHORT)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Int, jint, JPy_FROM_JINT, JPy_AS_JINT)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Long, jlong, JPy_FROM_JLONG, JPy_AS_JLONG)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Float, jfloat, JPy_FROM_JFLOAT, JPy_AS_JFLOAT)
+JField_DEFINE_PRIMITIVE_ACCESSORS(Double, jdouble, JPy_FROM_JDOUBLE, JPy_AS_JDOUBLE)
+
+PyObject* JField_GetObjectValue(JNIEnv* jenv, JPy_JField* field, jobject objectRef)
+{
+    PyObject* returnValue;
+    jobject item = (*jenv)->GetObjectField(jenv, objectRef, field->fid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJObjectWithType(jenv, item, field->type);
+    (*jenv)->DeleteLocalRef(jenv, item);
+    return returnValue;
+}
+
+int JField_SetObjectValue(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* pyValue)
+{
+    jobject item;
+    if (JPy_AsJObjectWithType(jenv, pyValue, &item, field->type) < 0) {
+        return -1;
+    }
+    (*jenv)->SetObjectField(jenv, objectRef, field->fid, item);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
+}
+
+/**
+ * Creates a new field whose type is resolved from the given field class on first access.
+ */
+JPy_JField* JField_New(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldName, jclass fieldClassRef, jboolean isStatic, jboolean isFinal, jfieldID fid)
 {
     PyTypeObject* type = &JField_Type;
     JPy_JField* field;
 
     field = (JPy_JField*) type->tp_alloc(type, 0);
+    if (field == NULL) {
+        return NULL;
+    }
     field->declaringClass = declaringClass;
     field->name = fieldName;
-    field->type = fieldType;
+    field->type = NULL;
+    field->typeRef = (*jenv)->NewGlobalRef(jenv, fieldClassRef);
     field->isStatic = isStatic;
     field->isFinal = isFinal;
     field->fid = fid;
+    field->GetFieldValue = NULL;
+    field->SetFieldValue = NULL;
 
     Py_INCREF(field->name);
-    Py_INCREF(field->type);
 
     return field;
 }
 
+/**
+ * Resolves the field's type and selects its accessor functions, if not already done.
+ * Returns -1 and sets a Python exception on failure.
+ */
+int JField_ResolveType(JNIEnv* jenv, JPy_JField* field)
+{
+    JPy_JType* fieldType;
+
+    if (field->type != NULL) {
+        return 0;
+    }
+
+    fieldType = JType_GetType(jenv, field->typeRef, JNI_FALSE);
+    if (fieldType == NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JField_ResolveType: error: Java field '%s' rejected because an error occurred during type processing\n", JPy_AS_UTF8(field->name));
+        return -1;
+    }
+
+    if (fieldType == JPy_JBoolean) {
+        field->GetFieldValue = JField_GetBooleanValue;
+        field->SetFieldValue = JField_SetBooleanValue;
+    } else if (fieldType == JPy_JChar) {
+        field->GetFieldValue = JField_GetCharValue;
+        field->SetFieldValue = JField_SetCharValue;
+    } else if (fieldType == JPy_JByte) {
+        field->GetFieldValue = JField_GetByteValue;
+        field->SetFieldValue = JField_SetByteValue;
+    } else if (fieldType == JPy_JShort) {
+        field->GetFieldValue = JField_GetShortValue;
+        field->SetFieldValue = JField_SetShortValue;
+    } else if (fieldType == JPy_JInt) {
+        field->GetFieldValue = JField_GetIntValue;
+        field->SetFieldValue = JField_SetIntValue;
+    } else if (fieldType == JPy_JLong) {
+        field->GetFieldValue = JField_GetLongValue;
+        field->SetFieldValue = JField_SetLongValue;
+    } else if (fieldType == JPy_JFloat) {
+        field->GetFieldValue = JField_GetFloatValue;
+        field->SetFieldValue = JField_SetFloatValue;
+    } else if (fieldType == JPy_JDouble) {
+        field->GetFieldValue = JField_GetDoubleValue;
+        field->SetFieldValue = JField_SetDoubleValue;
+    } else {
+        field->GetFieldValue = JField_GetObjectValue;
+        field->SetFieldValue = JField_SetObjectValue;
+    }
+
+    Py_INCREF(fieldType);
+    field->type = fieldType;
+
+    return 0;
+}
+
 /**
  * The JField type's tp_dealloc slot.
  */
 void JField_dealloc(JPy_JField* self)
 {
+    JNIEnv* jenv = JPy_GetReleaseJNIEnv();
+
+    if (self->typeRef != NULL) {
+        JPy_DeleteGlobalRef(jenv, self->typeRef);
+        self->typeRef = NULL;
+    }
+
     Py_DECREF(self->name);
-    Py_DECREF(self->type);
+    Py_XDECREF(self->type);
     Py_TYPE(self)->tp_free((PyObject*) self);
 }
 
@@ -82,6 +199,97 @@ PyObject* JField_str(JPy_JField* self)
 }
 
 
+/**
+ * Replaces a static final field in the __dict__ of its declaring class by the field's value.
+ * Returns a new reference to the value, or NULL and sets a Python exception on failure.
+ */
+PyObject* JField_GetStaticValue(JNIEnv* jenv, JPy_JField* self)
+{
+    JPy_JType* declaringClass;
+    PyObject* value;
+
+    declaringClass = self->declaringClass;
+
+    // Keep ourselves alive, we are going to be replaced in the type's __dict__.
+    Py_INCREF(self);
+    if (JField_ResolveType(jenv, self) < 0
+        || JType_AddFieldAttribute(jenv, declaringClass, self->name, self->type, self->fid) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    PyType_Modified(&declaringClass->typeObj);
+
+    value = PyDict_GetItem(declaringClass->typeObj.tp_dict, self->name);
+    Py_XINCREF(value);
+    Py_DECREF(self);
+    return value;
+}
+
+/**
+ * The JField type's tp_descr_get slot. Called if the field is accessed on an instance of its declaring class,
+ * in which case the Java field value is returned. Otherwise the JField itself is returned.
+ * Static final fields are looked up only once, on first access from the declaring class or its instances.
+ */
+PyObject* JField_descr_get(JPy_JField* self, PyObject* obj, PyObject* type)
+{
+    JNIEnv* jenv;
+    PyObject* value;
+
+    if (self->isStatic) {
+        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+        JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+        value = JField_GetStaticValue(jenv, self);
+        JPy_END_LOCAL_FRAME(jenv)
+        return value;
+    }
+
+    if (obj == NULL || !JObj_Check(obj)) {
+        Py_INCREF(self);
+        return (PyObject*) self;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    if (JField_ResolveType(jenv, self) < 0) {
+        return NULL;
+    }
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    value = self->GetFieldValue(jenv, self, ((JPy_JObj*) obj)->objectRef);
+    JPy_END_LOCAL_FRAME(jenv)
+    return value;
+}
+
+/**
+ * The JField type's tp_descr_set slot. Called if the field is assigned on an instance of its declaring class.
+ */
+int JField_descr_set(JPy_JField* self, PyObject* obj, PyObject* value)
+{
+    JNIEnv* jenv;
+    int result;
+
+    if (value == NULL) {
+        PyErr_Format(PyExc_AttributeError, "Java field '%s' cannot be deleted", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+    if (self->isStatic) {
+        PyErr_Format(PyExc_AttributeError, "Java field '%s' is static and final", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+    if (!JObj_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "Java field '%s' can only be set on Java objects", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+    if (JField_ResolveType(jenv, self) < 0) {
+        return -1;
+    }
+    JPy_BEGIN_LOCAL_FRAME(jenv, -1)
+    result = self->SetFieldValue(jenv, self, ((JPy_JObj*) obj)->objectRef, value);
+    JPy_END_LOCAL_FRAME(jenv)
+    return result;
+}
+
+
 static PyMemberDef JField_members[] =
 {
     {"name",        T_OBJECT_EX, offsetof(JPy_JField, name),       READONLY, "Field name"},
@@ -127,8 +335,8 @@ PyTypeObject JField_Type = {
     NULL,                         /* tp_getset */
     NULL,                         /* tp_base */
     NULL,                         /* tp_dict */
-    NULL,                         /* tp_descr_get */
-    NULL,                         /* tp_descr_set */
+    (descrgetfunc)JField_descr_get, /* tp_descr_get */
+    (descrsetfunc)JField_descr_set, /* tp_descr_set */
     0,                            /* tp_dictoffset */
     NULL,                         /* tp_init */
     NULL,                         /* tp_alloc */
@@ -23,10 +23,23 @@ extern "C" {
 
 #include "jpy_compat.h"
 
+struct JPy_JField;
+
+/**
+ * Gets the value of a Java object's field as Python object.
+ * Returns NULL and sets a Python exception on failure.
+ */
+typedef PyObject* (*JPy_GetFieldValue)(JNIEnv*, struct JPy_JField*, jobject);
+/**
+ * Sets the value of a Java object's field from a Python object.
+ * Returns -1 and sets a Python exception on failure.
+ */
+typedef int (*JPy_SetFieldValue)(JNIEnv*, struct JPy_JField*, jobject, PyObject*);
+
 /**
  * Python object representing a Java method. It's type is 'JMethod'.
  */
-typedef struct
+typedef struct JPy_JField
 {
     PyObject_HEAD
 
@@ -34,14 +47,20 @@ typedef struct
     JPy_JType* declaringClass;
     // Field name.
     PyObject* name;
-    // Field type.
+    // Field type, NULL until resolved from typeRef by JField_ResolveType().
     JPy_JType* type;
+    // Global reference to the field's Java class.
+    jclass typeRef;
     // Method is static?
     char isStatic;
     // Method is final?
     char isFinal;
     // Field ID retrieved from JNI.
     jfieldID fid;
+    // Gets the field value, selected by field type.
+    JPy_GetFieldValue GetFieldValue;
+    // Sets the field value, selected by field type.
+    JPy_SetFieldValue SetFieldValue;
 }
 JPy_JField;
 
@@ -50,7 +69,8 @@ JPy_JField;
  */
 extern PyTypeObject JField_Type;
 
-JPy_JField* JField_New(JPy_JType* declaringType, PyObject* fieldKey, JPy_JType* fieldType, jboolean isStatic, jboolean isFinal, jfieldID fid);
+JPy_JField* JField_New(JNIEnv* jenv, JPy_JType* declaringType, PyObject* fieldKey, jclass fieldClassRef, jboolean isStatic, jboolean isFinal, jfieldID fid);
+int JField_ResolveType(JNIEnv* jenv, JPy_JField* field);
 void JField_Del(JPy_JField* field);
 
 #ifdef __cplusplus
@@ -41,7 +41,9 @@ JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
     method->paramDescriptors = paramDescriptors;
     method->returnDescriptor = returnDescriptor;
     method->isStatic = isStatic;
+    method->releaseGIL = 0;
     method->mid = mid;
+    method->InvokeMethod = NULL;
 
     Py_INCREF(declaringClass);
     Py_INCREF(method->name);
@@ -55,13 +57,11 @@ JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
  */
 void JMethod_dealloc(JPy_JMethod* self)
 {
-    JNIEnv* jenv;
-
     Py_DECREF(self->declaringClass);
     Py_DECREF(self->name);
 
-    jenv = JPy_GetJNIEnv();
-    if (jenv != NULL) {
+    // No JNI calls here, the method may be deleted while a critical array view is in use
+    if (JPy_JVM != NULL) {
         int i;
         for (i = 0; i < self->paramCount; i++) {
             Py_DECREF((self->paramDescriptors + i)->type);
@@ -81,11 +81,11 @@ void JMethod_Del(JPy_JMethod* method)
 }
 
 /**
- * Matches the give Python argument tuple against the Java method's formal parameters.
+ * Matches the given Python arguments against the formal parameters of the Java method of the given dispatch entry.
  * Returns the sum of the i-th argument against the i-th Java parameter.
- * The maximum match value returned is 100 * method->paramCount.
+ * The maximum match value returned is 100 * entry->paramCount.
  */
-int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* method, int argCount, PyObject* pyArgs)
+int JMethod_MatchPyArgs(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs)
 {
     JPy_ParamDescriptor* paramDescriptor;
     PyObject* pyArg;
@@ -94,14 +94,14 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
     int i;
     int i0;
 
-    if (method->isStatic) {
-        //printf("Static! method->paramCount=%d, argCount=%d\n", method->paramCount, argCount);
-        if (method->paramCount != argCount) {
+    if (entry->isStatic) {
+        //printf("Static! entry->paramCount=%d, argCount=%d\n", entry->paramCount, argCount);
+        if (entry->paramCount != argCount) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: argument count mismatch (matchValue=0)\n");
             // argument count mismatch
             return 0;
         }
-        if (method->paramCount == 0) {
+        if (entry->paramCount == 0) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: no-argument static method (matchValue=100)\n");
             // There can't be any other static method overloads with no parameters
             return 100;
@@ -111,13 +111,13 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
         matchValueSum = 0;
     } else {
         PyObject* self;
-        //printf("Non-Static! method->paramCount=%d, argCount=%d\n", method->paramCount, argCount);
-        if (method->paramCount != argCount - 1) {
+        //printf("Non-Static! entry->paramCount=%d, argCount=%d\n", entry->paramCount, argCount);
+        if (entry->paramCount != argCount - 1) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: argument count mismatch (matchValue=0)\n");
             // argument count mismatch
             return 0;
         }
-        self = PyTuple_GetItem(pyArgs, 0);
+        self = pyArgs[0];
         if (self == Py_None) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: self argument is None (matchValue=0)\n");
             return 0;
@@ -128,22 +128,22 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
         }
 
         i0 = 1;
-        matchValueSum = JType_MatchPyArgAsJObject(jenv, declaringClass, self);
+        matchValueSum = JType_MatchPyArgAsJObject(jenv, entry->declaringClass, self);
         if (matchValueSum == 0) {
            JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: self argument does not match required Java class (matchValue=0)\n");
            return 0;
         }
-        if (method->paramCount == 0) {
+        if (entry->paramCount == 0) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: no-argument non-static method (matchValue=%d)\n", matchValueSum);
             // There can't be any other method overloads with no parameters
             return matchValueSum;
         }
     }
 
-    paramDescriptor = method->paramDescriptors;
+    paramDescriptor = entry->paramDescriptors;
     for (i = i0; i < argCount; i++) {
 
-        pyArg = PyTuple_GetItem(pyArgs, i);
+        pyArg = pyArgs[i];
         matchValue = paramDescriptor->MatchPyArg(jenv, paramDescriptor, pyArg);
 
         JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: pyArgs[%d]: paramDescriptor->type->javaName='%s', matchValue=%d\n", i, paramDescriptor->type->javaName, matchValue);
@@ -162,14 +162,57 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
     return matchValueSum;
 }
 
+/**
+ * Tests whether the match value computed by JMethod_MatchPyArgs() for the given arguments only depends on the
+ * Python types of the arguments. Only then a method resolved for the arguments may be cached.
+ */
+int JMethod_IsTypeStableMatch(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs)
+{
+    JPy_ParamDescriptor* paramDescriptor;
+    PyObject* pyArg;
+    int i;
+    int i0;
+
+    if (entry->isStatic) {
+        if (entry->paramCount != argCount) {
+            return 1;
+        }
+        i0 = 0;
+    } else {
+        PyObject* self;
+        if (entry->paramCount != argCount - 1) {
+            return 1;
+        }
+        self = pyArgs[0];
+        if (JObj_Check(self) && !JType_IsTypeStableMatch(jenv, entry->declaringClass, self)) {
+            return 0;
+        }
+        i0 = 1;
+    }
+
+    paramDescriptor = entry->paramDescriptors;
+    for (i = i0; i < argCount; i++) {
+        // All other param descriptors match on the argument's Python type only
+        if (paramDescriptor->MatchPyArg == JType_MatchPyArgAsJObjectParam) {
+            pyArg = pyArgs[i];
+            if (!JType_IsTypeStableMatch(jenv, paramDescriptor->type, pyArg)) {
+                return 0;
+            }
+        }
+        paramDescriptor++;
+    }
+
+    return 1;
+}
+
 #define JPy_SUPPORT_RETURN_PARAMETER 1
 
-PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jvalue* jArgs, int argOffset, JPy_JType* returnType, jobject jReturnValue)
+PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* const* pyArgs, jvalue* jArgs, int argOffset, JPy_JType* returnType, jobject jReturnValue)
 {
     #ifdef JPy_SUPPORT_RETURN_PARAMETER
     if (method->returnDescriptor->paramIndex >= 0) {
         jint paramIndex = method->returnDescriptor->paramIndex;
-        PyObject* pyReturnArg = PyTuple_GetItem(pyArgs, paramIndex + argOffset);
+        PyObject* pyReturnArg = pyArgs[paramIndex + argOffset];
         jobject jArg = jArgs[paramIndex].l;
         //printf("JMethod_FromJObject: paramIndex=%d, jArg=%p, isNone=%d\n", paramIndex, jArg, pyReturnArg == Py_None);
         if ((JObj_Check(pyReturnArg) || PyObject_CheckBuffer(pyReturnArg))
@@ -183,196 +226,264 @@ PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArg
 }
 
 /**
- * Invoke a method. We have already ensured that the Python arguments and expected Java parameters match.
+ * Defines the static and non-static invoke functions for Java methods returning the primitive type NAME.
+ * Function pointers to these are assigned to JPy_JMethod.InvokeMethod by JMethod_InitInvokeMethod() and are called
+ * with the dispatch entry of the method.
  */
-PyObject* JMethod_InvokeMethod(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs)
+#define JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(NAME, JTYPE, FROM_JTYPE) \
+PyObject* JMethod_InvokeStatic##NAME##Method(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs) \
+{ \
+    JTYPE v; \
+    JMethod_BEGIN_JAVA_CALL(entry->method) \
+    v = (*jenv)->CallStatic##NAME##MethodA(jenv, entry->declaringClass->classRef, entry->mid, jArgs); \
+    JMethod_END_JAVA_CALL \
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL); \
+    return FROM_JTYPE(v); \
+} \
+PyObject* JMethod_Invoke##NAME##Method(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs) \
+{ \
+    jobject objectRef = ((JPy_JObj*) pyArgs[0])->objectRef; \
+    JTYPE v; \
+    JMethod_BEGIN_JAVA_CALL(entry->method) \
+    v = (*jenv)->Call##NAME##MethodA(jenv, objectRef, entry->mid, jArgs); \
+    JMethod_END_JAVA_CALL \
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL); \
+    return FROM_JTYPE(v); \
+}
+
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Boolean, jboolean, JPy_FROM_JBOOLEAN)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Char, jchar, JPy_FROM_JCHAR)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Byte, jbyte, JPy_FROM_JBYTE)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Short, jshort, JPy_FROM_JSHORT)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Int, jint, JPy_FROM_JINT)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Long, jlong, JPy_FROM_JLONG)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Float, jfloat, JPy_FROM_JFLOAT)
+JMethod_DEFINE_INVOKE_PRIMITIVE_METHOD(Double, jdouble, JPy_FROM_JDOUBLE)
+
+PyObject* JMethod_InvokeStaticVoidMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
 {
-    jvalue* jArgs;
-    JPy_ArgDisposer* argDisposers;
-    PyObject* returnValue;
-    JPy_JType* declaringClass;
-    JPy_JType* returnType;
-    jclass classRef;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    (*jenv)->CallStaticVoidMethodA(jenv, entry->declaringClass->classRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JPy_FROM_JVOID();
+}
 
-    //printf("JMethod_InvokeMethod 1: typeCode=%c\n", typeCode);
-    if (JMethod_CreateJArgs(jenv, method, pyArgs, &jArgs, &argDisposers) < 0) {
-        return NULL;
-    }
+PyObject* JMethod_InvokeVoidMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
+{
+    jobject objectRef = ((JPy_JObj*) pyArgs[0])->objectRef;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    (*jenv)->CallVoidMethodA(jenv, objectRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JPy_FROM_JVOID();
+}
 
-    //printf("JMethod_InvokeMethod 2: typeCode=%c\n", typeCode);
+PyObject* JMethod_InvokeStaticStringMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
+{
+    PyObject* returnValue;
+    jstring v;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    v = (*jenv)->CallStaticObjectMethodA(jenv, entry->declaringClass->classRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJString(jenv, v);
+    (*jenv)->DeleteLocalRef(jenv, v);
+    return returnValue;
+}
 
-    returnType = method->returnDescriptor->type;
-    returnValue = NULL;
-    declaringClass = method->declaringClass;
-    classRef = declaringClass->classRef;
+PyObject* JMethod_InvokeStringMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
+{
+    jobject objectRef = ((JPy_JObj*) pyArgs[0])->objectRef;
+    PyObject* returnValue;
+    jstring v;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    v = (*jenv)->CallObjectMethodA(jenv, objectRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJString(jenv, v);
+    (*jenv)->DeleteLocalRef(jenv, v);
+    return returnValue;
+}
 
-    if (method->isStatic) {
+PyObject* JMethod_InvokeStaticObjectMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
+{
+    PyObject* returnValue;
+    jobject v;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    v = (*jenv)->CallStaticObjectMethodA(jenv, entry->declaringClass->classRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JMethod_FromJObject(jenv, entry->method, pyArgs, jArgs, 0, entry->method->returnDescriptor->type, v);
+    (*jenv)->DeleteLocalRef(jenv, v);
+    return returnValue;
+}
 
-        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling static Java method %s#%s\n", declaringClass->javaName, JPy_AS_UTF8(method->name));
+PyObject* JMethod_InvokeObjectMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, PyObject* const* pyArgs, jvalue* jArgs)
+{
+    jobject objectRef = ((JPy_JObj*) pyArgs[0])->objectRef;
+    PyObject* returnValue;
+    jobject v;
+    JMethod_BEGIN_JAVA_CALL(entry->method)
+    v = (*jenv)->CallObjectMethodA(jenv, objectRef, entry->mid, jArgs);
+    JMethod_END_JAVA_CALL
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JMethod_FromJObject(jenv, entry->method, pyArgs, jArgs, 1, entry->method->returnDescriptor->type, v);
+    (*jenv)->DeleteLocalRef(jenv, v);
+    return returnValue;
+}
 
-        if (returnType == JPy_JVoid) {
-            (*jenv)->CallStaticVoidMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JVOID();
-        } else if (returnType == JPy_JBoolean) {
-            jboolean v = (*jenv)->CallStaticBooleanMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBOOLEAN(v);
-        } else if (returnType == JPy_JChar) {
-            jchar v = (*jenv)->CallStaticCharMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JCHAR(v);
-        } else if (returnType == JPy_JByte) {
-            jbyte v = (*jenv)->CallStaticByteMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBYTE(v);
-        } else if (returnType == JPy_JShort) {
-            jshort v = (*jenv)->CallStaticShortMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JSHORT(v);
-        } else if (returnType == JPy_JInt) {
-            jint v = (*jenv)->CallStaticIntMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JINT(v);
-        } else if (returnType == JPy_JLong) {
-            jlong v = (*jenv)->CallStaticLongMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JLONG(v);
-        } else if (returnType == JPy_JFloat) {
-            jfloat v = (*jenv)->CallStaticFloatMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JFLOAT(v);
-        } else if (returnType == JPy_JDouble) {
-            jdouble v = (*jenv)->CallStaticDoubleMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JDOUBLE(v);
-        } else if (returnType == JPy_JString) {
-            jstring v = (*jenv)->CallStaticObjectMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FromJString(jenv, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
-        } else {
-            jobject v = (*jenv)->CallStaticObjectMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JMethod_FromJObject(jenv, method, pyArgs, jArgs, 0, returnType, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
-        }
+/**
+ * Selects the invoke function of the given method according to its return type.
+ * Constructors (which have no return type) are not invoked this way, see JObj_init().
+ */
+void JMethod_InitInvokeMethod(JPy_JMethod* method)
+{
+    JPy_JType* returnType;
+    jboolean isStatic;
+
+    if (method->returnDescriptor == NULL) {
+        method->InvokeMethod = NULL;
+        return;
+    }
 
+    returnType = method->returnDescriptor->type;
+    isStatic = method->isStatic;
+
+    if (returnType == JPy_JVoid) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticVoidMethod : JMethod_InvokeVoidMethod;
+    } else if (returnType == JPy_JBoolean) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticBooleanMethod : JMethod_InvokeBooleanMethod;
+    } else if (returnType == JPy_JChar) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticCharMethod : JMethod_InvokeCharMethod;
+    } else if (returnType == JPy_JByte) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticByteMethod : JMethod_InvokeByteMethod;
+    } else if (returnType == JPy_JShort) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticShortMethod : JMethod_InvokeShortMethod;
+    } else if (returnType == JPy_JInt) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticIntMethod : JMethod_InvokeIntMethod;
+    } else if (returnType == JPy_JLong) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticLongMethod : JMethod_InvokeLongMethod;
+    } else if (returnType == JPy_JFloat) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticFloatMethod : JMethod_InvokeFloatMethod;
+    } else if (returnType == JPy_JDouble) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticDoubleMethod : JMethod_InvokeDoubleMethod;
+    } else if (returnType == JPy_JString) {
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticStringMethod : JMethod_InvokeStringMethod;
     } else {
-        jobject objectRef;
-        PyObject* self;
+        method->InvokeMethod = isStatic ? JMethod_InvokeStaticObjectMethod : JMethod_InvokeObjectMethod;
+    }
+}
 
-        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling Java method %s#%s\n", declaringClass->javaName, JPy_AS_UTF8(method->name));
+/**
+ * Invoke the method of the given dispatch entry. We have already ensured that the Python arguments and expected
+ * Java parameters match.
+ */
+PyObject* JMethod_InvokeMethod(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs)
+{
+    jvalue jArgsBuffer[JPy_JARGS_BUFFER_SIZE];
+    JPy_ArgDisposer argDisposersBuffer[JPy_JARGS_BUFFER_SIZE];
+    jvalue* jArgs;
+    JPy_ArgDisposer* argDisposers;
+    PyObject* returnValue;
 
-        self = PyTuple_GetItem(pyArgs, 0);
-        // Note it is already ensured that self is a JPy_JObj*
-        objectRef = ((JPy_JObj*) self)->objectRef;
+    if (entry->InvokeMethod == NULL) {
+        // The buffer acquired by overload matching is otherwise released by JMethod_CreateJArgs()
+        JType_ReleaseArgBuffer();
+        PyErr_SetString(PyExc_RuntimeError, "internal error: Java method has no invoke function");
+        return NULL;
+    }
 
-        if (returnType == JPy_JVoid) {
-            (*jenv)->CallVoidMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JVOID();
-        } else if (returnType == JPy_JBoolean) {
-            jboolean v = (*jenv)->CallBooleanMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBOOLEAN(v);
-        } else if (returnType == JPy_JChar) {
-            jchar v = (*jenv)->CallCharMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JCHAR(v);
-        } else if (returnType == JPy_JByte) {
-            jbyte v = (*jenv)->CallByteMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBYTE(v);
-        } else if (returnType == JPy_JShort) {
-            jshort v = (*jenv)->CallShortMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JSHORT(v);
-        } else if (returnType == JPy_JInt) {
-            jint v = (*jenv)->CallIntMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JINT(v);
-        } else if (returnType == JPy_JLong) {
-            jlong v = (*jenv)->CallLongMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JLONG(v);
-        } else if (returnType == JPy_JFloat) {
-            jfloat v = (*jenv)->CallFloatMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JFLOAT(v);
-        } else if (returnType == JPy_JDouble) {
-            jdouble v = (*jenv)->CallDoubleMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JDOUBLE(v);
-        } else if (returnType == JPy_JString) {
-            jstring v = (*jenv)->CallObjectMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FromJString(jenv, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
-        } else {
-            jobject v = (*jenv)->CallObjectMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JMethod_FromJObject(jenv, method, pyArgs, jArgs, 1, returnType, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
-        }
+    if (JMethod_CreateJArgs(jenv, entry, argCount, pyArgs, jArgsBuffer, argDisposersBuffer, &jArgs, &argDisposers) < 0) {
+        return NULL;
     }
 
-error:
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling %sJava method %s#%s\n", entry->isStatic ? "static " : "", entry->declaringClass->javaName, JPy_AS_UTF8(entry->method->name));
+
+    returnValue = entry->InvokeMethod(jenv, entry, pyArgs, jArgs);
+
     if (jArgs != NULL) {
-        JMethod_DisposeJArgs(jenv, method->paramCount, jArgs, argDisposers);
+        JMethod_DisposeJArgs(jenv, entry->paramCount, jArgs, argDisposers);
     }
 
     return returnValue;
 }
 
-int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet)
+void JMethod_DisposeJArgs0(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers);
+
+int JMethod_CreateJArgs0(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs, jvalue* argValuesBuffer, JPy_ArgDisposer* argDisposersBuffer, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet);
+
+/**
+ * Converts the Python arguments into Java argument values. If the method has no more than JPy_JARGS_BUFFER_SIZE
+ * parameters, the given buffers (which must be able to hold JPy_JARGS_BUFFER_SIZE items) are used, otherwise
+ * the argument values and disposers are allocated on the heap. In any case, JMethod_DisposeJArgs() must be
+ * called to release them.
+ */
+int JMethod_CreateJArgs(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs, jvalue* argValuesBuffer, JPy_ArgDisposer* argDisposersBuffer, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet)
+{
+    int result;
+
+    result = JMethod_CreateJArgs0(jenv, entry, argCount, pyArgs, argValuesBuffer, argDisposersBuffer, argValuesRet, argDisposersRet);
+    // A buffer acquired by overload matching but not taken over by the conversion is no longer needed
+    JType_ReleaseArgBuffer();
+    return result;
+}
+
+int JMethod_CreateJArgs0(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* pyArgs, jvalue* argValuesBuffer, JPy_ArgDisposer* argDisposersBuffer, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet)
 {
     JPy_ParamDescriptor* paramDescriptor;
-    int i, i0, argCount;
+    int i, i0;
     PyObject* pyArg;
     jvalue* jValue;
     jvalue* jValues;
     JPy_ArgDisposer* argDisposer;
     JPy_ArgDisposer* argDisposers;
 
-    if (method->paramCount == 0) {
+    if (entry->paramCount == 0) {
         *argValuesRet = NULL;
         *argDisposersRet = NULL;
         return 0;
     }
 
-    argCount = PyTuple_Size(pyArgs);
-
-    i0 = argCount - method->paramCount;
+    i0 = argCount - entry->paramCount;
     if (!(i0 == 0 || i0 == 1)) {
         PyErr_SetString(PyExc_RuntimeError, "internal error");
         return -1;
     }
 
-    jValues = PyMem_New(jvalue, method->paramCount);
-    if (jValues == NULL) {
-        PyErr_NoMemory();
-        return -1;
-    }
+    if (entry->paramCount <= JPy_JARGS_BUFFER_SIZE) {
+        jValues = argValuesBuffer;
+        argDisposers = argDisposersBuffer;
+    } else {
+        jValues = PyMem_New(jvalue, entry->paramCount);
+        if (jValues == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
 
-    argDisposers = PyMem_New(JPy_ArgDisposer, method->paramCount);
-    if (argDisposers == NULL) {
-        PyMem_Del(jValues);
-        PyErr_NoMemory();
-        return -1;
+        argDisposers = PyMem_New(JPy_ArgDisposer, entry->paramCount);
+        if (argDisposers == NULL) {
+            PyMem_Del(jValues);
+            PyErr_NoMemory();
+            return -1;
+        }
     }
 
-    paramDescriptor = method->paramDescriptors;
+    paramDescriptor = entry->paramDescriptors;
     jValue = jValues;
     argDisposer = argDisposers;
     for (i = i0; i < argCount; i++) {
-        pyArg = PyTuple_GetItem(pyArgs, i);
+        pyArg = pyArgs[i];
         jValue->l = 0;
         argDisposer->data = NULL;
         argDisposer->DisposeArg = NULL;
         if (paramDescriptor->ConvertPyArg(jenv, paramDescriptor, pyArg, jValue, argDisposer) < 0) {
-            PyMem_Del(jValues);
-            PyMem_Del(argDisposers);
+            // Dispose the arguments converted so far
+            JMethod_DisposeJArgs0(jenv, i - i0, jValues, argDisposers);
+            if (entry->paramCount > JPy_JARGS_BUFFER_SIZE) {
+                PyMem_Del(jValues);
+                PyMem_Del(argDisposers);
+            }
             return -1;
         }
         paramDescriptor++;
@@ -385,7 +496,7 @@ int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jva
     return 0;
 }
 
-void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
+void JMethod_DisposeJArgs0(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
 {
     jvalue* jArg;
     JPy_ArgDisposer* argDisposer;
@@ -401,9 +512,17 @@ void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDi
         jArg++;
         argDisposer++;
     }
+}
 
-    PyMem_Del(jArgs);
-    PyMem_Del(argDisposers);
+void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
+{
+    JMethod_DisposeJArgs0(jenv, paramCount, jArgs, argDisposers);
+
+    if (paramCount > JPy_JARGS_BUFFER_SIZE) {
+        // Not the caller's buffers, see JMethod_CreateJArgs()
+        PyMem_Del(jArgs);
+        PyMem_Del(argDisposers);
+    }
 }
 
 
@@ -430,6 +549,7 @@ static PyMemberDef JMethod_members[] =
     {"name",        T_OBJECT_EX, offsetof(JPy_JMethod, name),       READONLY, "Method name"},
     {"param_count", T_INT,       offsetof(JPy_JMethod, paramCount), READONLY, "Number of method parameters"},
     {"is_static",   T_BOOL,      offsetof(JPy_JMethod, isStatic),   READONLY, "Tests if this is a static method"},
+    {"release_gil", T_BOOL,      offsetof(JPy_JMethod, releaseGIL), 0,        "Whether the Python GIL is released while the Java method is executing"},
     {NULL}  /* Sentinel */
 };
 
@@ -606,214 +726,1412 @@ PyTypeObject JMethod_Type = {
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  JOverloadedMethod
 
-typedef struct JPy_MethodFindResult
+/**
+ * Returns NULL (error), Py_None (borrowed ref), or the overloaded method of the same name in the super class of the
+ * given overloaded method's declaring class (borrowed ref).
+ */
+PyObject* JOverloadedMethod_GetSuperMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod)
 {
-    JPy_JMethod* method;
-    int matchValue;
-    int matchCount;
+    JPy_JType* superClass;
+
+    superClass = overloadedMethod->declaringClass->superType;
+    if (superClass == NULL) {
+        return Py_None;
+    }
+    return JType_GetOverloadedMethod(jenv, superClass, overloadedMethod->name, JNI_TRUE);
 }
-JPy_MethodFindResult;
 
-JPy_JMethod* JOverloadedMethod_FindMethod0(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* pyArgs, JPy_MethodFindResult* result)
+/**
+ * Returns the number of Python arguments a method overload accepts, including 'self' for non-static methods.
+ */
+#define JMethod_GET_ARG_COUNT(METHOD) ((METHOD)->paramCount + ((METHOD)->isStatic ? 0 : 1))
+
+/**
+ * Tests whether the two method overloads have the same parameter types, i.e. whether one overrides the other.
+ */
+int JMethod_IsSameSignature(JPy_JMethod* method1, JPy_JMethod* method2)
 {
-    int overloadCount;
-    int argCount;
-    int matchCount;
-    int matchValue;
-    int matchValueMax;
-    JPy_JMethod* currMethod;
-    JPy_JMethod* bestMethod;
     int i;
 
-    result->method = NULL;
-    result->matchValue = 0;
-    result->matchCount = 0;
-
-    overloadCount = PyList_Size(overloadedMethod->methodList);
-    if (overloadCount <= 0) {
-        PyErr_SetString(PyExc_RuntimeError, "internal error: invalid overloadedMethod->methodList");
-        return NULL;
+    if (method1->paramCount != method2->paramCount || method1->isStatic != method2->isStatic) {
+        return 0;
     }
+    for (i = 0; i < method1->paramCount; i++) {
+        if (method1->paramDescriptors[i].type != method2->paramDescriptors[i].type) {
+            return 0;
+        }
+    }
+    return 1;
+}
 
-    argCount = PyTuple_Size(pyArgs);
-    matchCount = 0;
-    matchValueMax = -1;
-    bestMethod = NULL;
+/**
+ * Returns the sum of the method generations of the overloaded method's declaring class and its super classes.
+ * It changes whenever an overload is added to any overloaded method the dispatch table is built from.
+ */
+int JOverloadedMethod_GetChainGeneration(JPy_JOverloadedMethod* overloadedMethod)
+{
+    JPy_JType* type;
+    int generation;
 
-    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: method '%s#%s': overloadCount=%d\n",
-                              overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), overloadCount);
+    generation = 0;
+    for (type = overloadedMethod->declaringClass; type != NULL; type = type->superType) {
+        generation += type->methodGeneration;
+    }
+    return generation;
+}
+
+/**
+ * Tests whether the dispatch table of the given overloaded method is up to date.
+ */
+#define JOverloadedMethod_IS_DISPATCH_TABLE_VALID(OM) \
+    ((OM)->dispatchStarts != NULL && ((OM)->dispatchFinal || (OM)->dispatchGeneration == JOverloadedMethod_GetChainGeneration(OM)))
 
-    for (i = 0; i < overloadCount; i++) {
-        currMethod = (JPy_JMethod*) PyList_GetItem(overloadedMethod->methodList, i);
-        matchValue = JMethod_MatchPyArgs(jenv, overloadedMethod->declaringClass, currMethod, argCount, pyArgs);
+/**
+ * Initialises a dispatch entry from the members of the given method, taking a new reference to it.
+ */
+void JMethod_InitDispatchEntry(JPy_MethodDispatchEntry* entry, JPy_JMethod* method, int level)
+{
+    entry->method = method;
+    entry->declaringClass = method->declaringClass;
+    entry->paramDescriptors = method->paramDescriptors;
+    entry->mid = method->mid;
+    entry->InvokeMethod = method->InvokeMethod;
+    entry->paramCount = method->paramCount;
+    entry->isStatic = method->isStatic;
+    entry->level = level;
+    Py_INCREF(method);
+}
 
-        JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: methodList[%d]: paramCount=%d, matchValue=%d\n", i,
-                                  currMethod->paramCount, matchValue);
+/**
+ * Releases the dispatch table of the given overloaded method.
+ */
+void JOverloadedMethod_ClearDispatchTable(JPy_JOverloadedMethod* overloadedMethod)
+{
+    int i;
 
-        if (matchValue > 0) {
-            if (matchValue > matchValueMax) {
-                matchValueMax = matchValue;
-                bestMethod = currMethod;
-                matchCount = 1;
-            } else if (matchValue == matchValueMax) {
-                matchCount++;
-            }
-            if (matchValue >= 100 * argCount) {
-                // we can't get any better (if so, we have an internal problem)
-                break;
-            }
+    if (overloadedMethod->dispatchEntries != NULL) {
+        for (i = 0; i < overloadedMethod->dispatchStarts[overloadedMethod->dispatchMaxArgCount + 1]; i++) {
+            Py_DECREF(overloadedMethod->dispatchEntries[i].method);
         }
+        PyMem_Del(overloadedMethod->dispatchEntries);
     }
+    PyMem_Del(overloadedMethod->dispatchStarts);
 
-    if (bestMethod == NULL) {
-        matchValueMax = 0;
-        matchCount = 0;
-    }
-
-    result->method = bestMethod;
-    result->matchValue = matchValueMax;
-    result->matchCount = matchCount;
-
-    return bestMethod;
+    overloadedMethod->dispatchEntries = NULL;
+    overloadedMethod->dispatchStarts = NULL;
+    overloadedMethod->dispatchMaxArgCount = -1;
+    overloadedMethod->dispatchGeneration = -1;
+    overloadedMethod->dispatchFinal = JNI_FALSE;
 }
 
-JPy_JMethod* JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* pyArgs, jboolean visitSuperClass)
+/**
+ * Builds the dispatch table of the given overloaded method. It comprises the overloads of the method itself and of
+ * the overloaded methods of the same name in all of its super classes, so that calls never need to walk the
+ * super class chain. Overloads of super classes overridden in derived classes are left out, they could never be
+ * selected. The overloads are grouped by the number of Python arguments they accept, within each group they are
+ * ordered by level, i.e. overloads of derived classes come first.
+ * Once the declaring class and all of its super classes are resolved, no overloads can be added anymore and the
+ * table is final. It is then built only once.
+ */
+int JOverloadedMethod_BuildDispatchTable(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod)
 {
     JPy_JOverloadedMethod* currentOM;
-    JPy_MethodFindResult result;
-    JPy_MethodFindResult bestResult;
-    JPy_JType* superClass;
+    JPy_MethodDispatchEntry* entries;
+    JPy_JMethod* method;
     PyObject* superOM;
+    PyObject* chain;
+    JPy_JType* type;
+    jboolean isFinal;
+    int* starts;
+    int entryCount;
+    int maxArgCount;
+    int overloadCount;
+    int levelCount;
+    int level;
     int argCount;
+    int i, j;
 
-    argCount = PyTuple_Size(pyArgs);
+    JOverloadedMethod_ClearDispatchTable(overloadedMethod);
+    // The cached methods have been resolved using the previous table
+    JOverloadedMethod_ClearCache(overloadedMethod);
 
-    if ((JPy_DiagFlags & JPy_DIAG_F_METH) != 0) {
-        int i;
-        printf("JOverloadedMethod_FindMethod: argCount=%d, visitSuperClass=%d\n", argCount, visitSuperClass);
-        for (i = 0; i < argCount; i++) {
-            PyObject* pyArg = PyTuple_GetItem(pyArgs, i);
-            printf("\tPy_TYPE(pyArgs[%d])->tp_name = %s\n", i, Py_TYPE(pyArg)->tp_name);
-        }
+    chain = PyList_New(0);
+    if (chain == NULL) {
+        return -1;
     }
 
-    bestResult.method = NULL;
-    bestResult.matchValue = 0;
-    bestResult.matchCount = 0;
-
+    // Collect the overloaded methods of the super classes and count their overloads
+    entryCount = 0;
+    maxArgCount = -1;
     currentOM = overloadedMethod;
     while (1) {
-        if (JOverloadedMethod_FindMethod0(jenv, currentOM, pyArgs, &result) < 0) {
-            // oops, error
-            return NULL;
-        }
-        if (result.method != NULL) {
-            if (result.matchValue >= 100 * argCount) {
-                // We can't get any better.
-                return result.method;
-            } else if (result.matchValue > 0 && result.matchValue > bestResult.matchValue) {
-                // We may have better matching methods overloads in the super class (if any)
-                bestResult = result;
-            }
+        if (PyList_Append(chain, (PyObject*) currentOM) < 0
+            || JOverloadedMethod_ResolvePendingMethods(jenv, currentOM) < 0) {
+            Py_DECREF(chain);
+            return -1;
         }
-
-        if (visitSuperClass) {
-            superClass = currentOM->declaringClass->superType;
-            if (superClass != NULL) {
-                superOM = JType_GetOverloadedMethod(jenv, superClass, currentOM->name, JNI_TRUE);
-            } else {
-                superOM = Py_None;
+        overloadCount = currentOM->methodCount;
+        for (i = 0; i < overloadCount; i++) {
+            method = currentOM->methods[i];
+            argCount = JMethod_GET_ARG_COUNT(method);
+            if (argCount > maxArgCount) {
+                maxArgCount = argCount;
             }
-        } else {
-            superOM = Py_None;
         }
+        entryCount += overloadCount;
 
+        superOM = JOverloadedMethod_GetSuperMethod(jenv, currentOM);
         if (superOM == NULL) {
-            // oops, error
-            return NULL;
+            Py_DECREF(chain);
+            return -1;
         } else if (superOM == Py_None) {
-            // no overloaded methods found in super class, so return best result found so far
-            if (bestResult.method == NULL) {
-                PyErr_SetString(PyExc_RuntimeError, "no matching Java method overloads found");
-                return NULL;
-            } else if (bestResult.matchCount > 1) {
-                PyErr_SetString(PyExc_RuntimeError, "ambiguous Java method call, too many matching method overloads found");
-                return NULL;
-            } else {
-                return bestResult.method;
-            }
-        } else {
-            // Continue trying with overloads from super type
-            currentOM = (JPy_JOverloadedMethod*) superOM;
+            break;
         }
+        currentOM = (JPy_JOverloadedMethod*) superOM;
     }
 
-    // Should never come here
-    PyErr_SetString(PyExc_RuntimeError, "internal error");
-    return NULL;
-}
-
-JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject* name, JPy_JMethod* method)
-{
-    PyTypeObject* methodType = &JOverloadedMethod_Type;
-    JPy_JOverloadedMethod* overloadedMethod;
-
-    overloadedMethod = (JPy_JOverloadedMethod*) methodType->tp_alloc(methodType, 0);
-    overloadedMethod->declaringClass = declaringClass;
-    overloadedMethod->name = name;
-    overloadedMethod->methodList = PyList_New(0);
+    entries = PyMem_New(JPy_MethodDispatchEntry, entryCount > 0 ? entryCount : 1);
+    starts = PyMem_New(int, maxArgCount + 2);
+    if (entries == NULL || starts == NULL) {
+        PyMem_Del(entries);
+        PyMem_Del(starts);
+        Py_DECREF(chain);
+        PyErr_NoMemory();
+        return -1;
+    }
 
-    Py_INCREF((PyObject*) overloadedMethod->declaringClass);
-    Py_INCREF((PyObject*) overloadedMethod->name);
-    Py_INCREF((PyObject*) overloadedMethod);
+    // Fill the groups one after the other, each one in level order
+    levelCount = (int) PyList_GET_SIZE(chain);
+    entryCount = 0;
+    for (argCount = 0; argCount <= maxArgCount; argCount++) {
+        starts[argCount] = entryCount;
+        for (level = 0; level < levelCount; level++) {
+            currentOM = (JPy_JOverloadedMethod*) PyList_GET_ITEM(chain, level);
+            overloadCount = currentOM->methodCount;
+            for (i = 0; i < overloadCount; i++) {
+                method = currentOM->methods[i];
+                if (JMethod_GET_ARG_COUNT(method) != argCount) {
+                    continue;
+                }
+                if (level > 0) {
+                    // Overloads of the same level can't override each other
+                    for (j = starts[argCount]; j < entryCount && entries[j].level < level; j++) {
+                        if (JMethod_IsSameSignature(entries[j].method, method)) {
+                            break;
+                        }
+                    }
+                    if (j < entryCount && entries[j].level < level) {
+                        JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_BuildDispatchTable: overload of '%s#%s' overridden by '%s'\n",
+                                       currentOM->declaringClass->javaName, JPy_AS_UTF8(method->name), entries[j].method->declaringClass->javaName);
+                        continue;
+                    }
+                }
+                JMethod_InitDispatchEntry(entries + entryCount, method, level);
+                entryCount++;
+            }
+        }
+    }
+    starts[maxArgCount + 1] = entryCount;
+
+    // Once all classes are resolved, the table is final
+    isFinal = JNI_TRUE;
+    for (type = overloadedMethod->declaringClass; type != NULL; type = type->superType) {
+        if (!type->isResolved) {
+            isFinal = JNI_FALSE;
+            break;
+        }
+    }
 
-    JOverloadedMethod_AddMethod(overloadedMethod, method);
+    Py_DECREF(chain);
 
-    return overloadedMethod;
-}
+    overloadedMethod->dispatchEntries = entries;
+    overloadedMethod->dispatchStarts = starts;
+    overloadedMethod->dispatchMaxArgCount = maxArgCount;
+    overloadedMethod->dispatchGeneration = JOverloadedMethod_GetChainGeneration(overloadedMethod);
+    overloadedMethod->dispatchFinal = isFinal;
 
-int JOverloadedMethod_AddMethod(JPy_JOverloadedMethod* overloadedMethod, JPy_JMethod* method)
-{
-    return PyList_Append(overloadedMethod->methodList, (PyObject*) method);
+    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_BuildDispatchTable: method '%s#%s': levelCount=%d, entryCount=%d, maxArgCount=%d, isFinal=%d\n",
+                   overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), levelCount, entryCount, maxArgCount, isFinal);
+    return 0;
 }
 
 /**
- * The 'JOverloadedMethod' type's tp_dealloc slot.
+ * Looks up the method resolved for the Python types of the given arguments in the overloaded method's cache.
+ * Returns its cached dispatch entry or NULL, if no such method has been cached.
  */
-void JOverloadedMethod_dealloc(JPy_JOverloadedMethod* self)
+const JPy_MethodDispatchEntry* JOverloadedMethod_GetCachedMethod(JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* pyArgs, jboolean visitSuperClass)
 {
-    Py_DECREF((PyObject*) self->declaringClass);
-    Py_DECREF((PyObject*) self->name);
-    Py_DECREF((PyObject*) self->methodList);
-    Py_TYPE(self)->tp_free((PyObject*) self);
+    JPy_MethodCacheEntry* entry;
+    int i, j;
+
+    if (!JOverloadedMethod_IS_DISPATCH_TABLE_VALID(overloadedMethod)) {
+        // The cache is cleared when the dispatch table is rebuilt
+        return NULL;
+    }
+
+    for (i = 0; i < JPy_METHOD_CACHE_SIZE; i++) {
+        entry = overloadedMethod->cache + i;
+        if (entry->argCount != argCount || entry->visitSuperClass != visitSuperClass) {
+            continue;
+        }
+        for (j = 0; j < argCount; j++) {
+            if (entry->argTypes[j] != Py_TYPE(pyArgs[j])) {
+                break;
+            }
+        }
+        if (j == argCount) {
+            return &entry->dispatchEntry;
+        }
+    }
+
+    return NULL;
 }
 
 /**
- * The 'JOverloadedMethod' type's tp_call slot. Makes instances of the 'JOverloadedMethod' type callable.
+ * Stores the method resolved for the Python types of the given arguments in the overloaded method's cache.
  */
-PyObject* JOverloadedMethod_call(JPy_JOverloadedMethod* self, PyObject *args, PyObject *kw)
+void JOverloadedMethod_SetCachedMethod(JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* pyArgs, jboolean visitSuperClass, const JPy_MethodDispatchEntry* dispatchEntry)
 {
-    JNIEnv* jenv;
-    JPy_JMethod* method;
+    JPy_MethodCacheEntry* entry;
+    int j;
 
-    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    if (argCount > JPy_METHOD_CACHE_MAX_ARGS) {
+        return;
+    }
 
-    method = JOverloadedMethod_FindMethod(jenv, self, args, JNI_TRUE);
-    if (method == NULL) {
-        return NULL;
+    entry = overloadedMethod->cache + overloadedMethod->cacheNext;
+    overloadedMethod->cacheNext = (overloadedMethod->cacheNext + 1) % JPy_METHOD_CACHE_SIZE;
+
+    if (entry->dispatchEntry.method != NULL) {
+        for (j = 0; j < entry->argCount; j++) {
+            Py_DECREF(entry->argTypes[j]);
+        }
+        Py_DECREF(entry->dispatchEntry.method);
     }
 
-    return JMethod_InvokeMethod(jenv, method, args);
+    for (j = 0; j < argCount; j++) {
+        entry->argTypes[j] = Py_TYPE(pyArgs[j]);
+        Py_INCREF(entry->argTypes[j]);
+    }
+    entry->argCount = argCount;
+    entry->visitSuperClass = visitSuperClass;
+    entry->dispatchEntry = *dispatchEntry;
+    Py_INCREF(dispatchEntry->method);
 }
 
 /**
- * The 'JOverloadedMethod' type's tp_repr slot.
+ * Removes all entries from the overloaded method's cache.
+ */
+void JOverloadedMethod_ClearCache(JPy_JOverloadedMethod* overloadedMethod)
+{
+    JPy_MethodCacheEntry* entry;
+    int i, j;
+
+    for (i = 0; i < JPy_METHOD_CACHE_SIZE; i++) {
+        entry = overloadedMethod->cache + i;
+        if (entry->dispatchEntry.method != NULL) {
+            for (j = 0; j < entry->argCount; j++) {
+                Py_DECREF(entry->argTypes[j]);
+            }
+            Py_DECREF(entry->dispatchEntry.method);
+        }
+        entry->argCount = -1;
+        memset(&entry->dispatchEntry, 0, sizeof(JPy_MethodDispatchEntry));
+    }
+    overloadedMethod->cacheNext = 0;
+}
+
+/**
+ * Returns the dispatch table entries of the overloads that accept the given number of Python arguments.
+ * The dispatch table is (re-)built on demand.
+ */
+int JOverloadedMethod_GetDispatchEntries(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, JPy_MethodDispatchEntry** entries, int* entryCount)
+{
+    if (!JOverloadedMethod_IS_DISPATCH_TABLE_VALID(overloadedMethod)) {
+        if (JOverloadedMethod_BuildDispatchTable(jenv, overloadedMethod) < 0) {
+            return -1;
+        }
+    }
+
+    if (argCount < 0 || argCount > overloadedMethod->dispatchMaxArgCount) {
+        *entries = NULL;
+        *entryCount = 0;
+    } else {
+        *entries = overloadedMethod->dispatchEntries + overloadedMethod->dispatchStarts[argCount];
+        *entryCount = overloadedMethod->dispatchStarts[argCount + 1] - overloadedMethod->dispatchStarts[argCount];
+    }
+    return 0;
+}
+
+/**
+ * Matches the given arguments against the overloads in the dispatch table that accept their number.
+ * The overloads of each level are matched in turn. A perfect match is returned immediately, otherwise the best
+ * match of the level with the highest match value wins, where derived classes take precedence over super classes
+ * in case of equal match values.
+ */
+const JPy_MethodDispatchEntry* JOverloadedMethod_FindMethod1(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* pyArgs, jboolean visitSuperClass, int* isTypeStable)
+{
+    JPy_MethodDispatchEntry* entries;
+    const JPy_MethodDispatchEntry* currEntry;
+    const JPy_MethodDispatchEntry* levelEntry;
+    const JPy_MethodDispatchEntry* bestEntry;
+    int entryCount;
+    int levelMatchValue;
+    int levelMatchCount;
+    int bestMatchValue;
+    int bestMatchCount;
+    int matchValue;
+    int level;
+    int i;
+
+    if ((JPy_DiagFlags & JPy_DIAG_F_METH) != 0) {
+        printf("JOverloadedMethod_FindMethod: argCount=%d, visitSuperClass=%d\n", argCount, visitSuperClass);
+        for (i = 0; i < argCount; i++) {
+            PyObject* pyArg = pyArgs[i];
+            printf("\tPy_TYPE(pyArgs[%d])->tp_name = %s\n", i, Py_TYPE(pyArg)->tp_name);
+        }
+    }
+
+    if (JOverloadedMethod_GetDispatchEntries(jenv, overloadedMethod, argCount, &entries, &entryCount) < 0) {
+        return NULL;
+    }
+
+    // Methods won't be cached for more arguments anyway
+    *isTypeStable = argCount <= JPy_METHOD_CACHE_MAX_ARGS;
+
+    bestEntry = NULL;
+    bestMatchValue = 0;
+    bestMatchCount = 0;
+
+    i = 0;
+    while (i < entryCount) {
+        level = entries[i].level;
+        if (level > 0 && !visitSuperClass) {
+            break;
+        }
+
+        levelEntry = NULL;
+        levelMatchValue = 0;
+        levelMatchCount = 0;
+        for (; i < entryCount && entries[i].level == level; i++) {
+            currEntry = entries + i;
+            matchValue = JMethod_MatchPyArgs(jenv, currEntry, argCount, pyArgs);
+
+            JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod1: level %d: paramCount=%d, matchValue=%d\n", level,
+                                      currEntry->paramCount, matchValue);
+
+            if (*isTypeStable && !JMethod_IsTypeStableMatch(jenv, currEntry, argCount, pyArgs)) {
+                *isTypeStable = 0;
+            }
+
+            if (matchValue > 0) {
+                if (matchValue > levelMatchValue) {
+                    levelMatchValue = matchValue;
+                    levelEntry = currEntry;
+                    levelMatchCount = 1;
+                } else if (matchValue == levelMatchValue) {
+                    levelMatchCount++;
+                }
+                if (matchValue >= 100 * argCount) {
+                    // We can't get any better.
+                    return levelEntry;
+                }
+            }
+        }
+
+        if (levelEntry != NULL && levelMatchValue > bestMatchValue) {
+            // We may have better matching methods overloads in the super class (if any)
+            bestEntry = levelEntry;
+            bestMatchValue = levelMatchValue;
+            bestMatchCount = levelMatchCount;
+        }
+    }
+
+    if (bestEntry == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "no matching Java method overloads found");
+        return NULL;
+    } else if (bestMatchCount > 1) {
+        PyErr_SetString(PyExc_RuntimeError, "ambiguous Java method call, too many matching method overloads found");
+        return NULL;
+    }
+    return bestEntry;
+}
+
+/**
+ * Resolves the method overload to be called with the given arguments and copies its dispatch entry into the given one.
+ * The entry holds a new reference to the method, so it stays valid even if the dispatch table is rebuilt while the
+ * arguments are converted. The caller must release it.
+ */
+int JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* pyArgs, jboolean visitSuperClass, JPy_MethodDispatchEntry* entry)
+{
+    const JPy_MethodDispatchEntry* foundEntry;
+    int isTypeStable;
+
+    foundEntry = JOverloadedMethod_GetCachedMethod(overloadedMethod, argCount, pyArgs, visitSuperClass);
+    if (foundEntry != NULL) {
+        overloadedMethod->cacheHits++;
+        *entry = *foundEntry;
+        Py_INCREF(entry->method);
+        return 0;
+    }
+
+    overloadedMethod->cacheMisses++;
+
+    foundEntry = JOverloadedMethod_FindMethod1(jenv, overloadedMethod, argCount, pyArgs, visitSuperClass, &isTypeStable);
+    if (foundEntry == NULL) {
+        // Otherwise released once the arguments are converted, see JMethod_CreateJArgs()
+        JType_ReleaseArgBuffer();
+        return -1;
+    }
+
+    if (isTypeStable) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod: caching method '%s#%s' for argCount=%d\n",
+                                  overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), argCount);
+        JOverloadedMethod_SetCachedMethod(overloadedMethod, argCount, pyArgs, visitSuperClass, foundEntry);
+    }
+
+    *entry = *foundEntry;
+    Py_INCREF(entry->method);
+    return 0;
+}
+
+#if defined(JPY_VECTORCALL)
+PyObject* JOverloadedMethod_vectorcall(PyObject* self, PyObject* const* args, size_t nargsf, PyObject* kwnames);
+#endif
+
+JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject* name, JPy_JMethod* method)
+{
+    PyTypeObject* methodType = &JOverloadedMethod_Type;
+    JPy_JOverloadedMethod* overloadedMethod;
+
+    overloadedMethod = (JPy_JOverloadedMethod*) methodType->tp_alloc(methodType, 0);
+    overloadedMethod->declaringClass = declaringClass;
+    overloadedMethod->name = name;
+    overloadedMethod->methods = NULL;
+    overloadedMethod->methodCount = 0;
+    overloadedMethod->pendingMethods = NULL;
+    overloadedMethod->pendingCount = 0;
+    overloadedMethod->cacheHits = 0;
+    overloadedMethod->cacheMisses = 0;
+    overloadedMethod->dispatchEntries = NULL;
+    overloadedMethod->dispatchStarts = NULL;
+    overloadedMethod->dispatchMaxArgCount = -1;
+    overloadedMethod->dispatchGeneration = -1;
+    overloadedMethod->dispatchFinal = JNI_FALSE;
+#if defined(JPY_VECTORCALL)
+    overloadedMethod->vectorcall = JOverloadedMethod_vectorcall;
+#endif
+    JOverloadedMethod_ClearCache(overloadedMethod);
+
+    Py_INCREF((PyObject*) overloadedMethod->declaringClass);
+    Py_INCREF((PyObject*) overloadedMethod->name);
+    Py_INCREF((PyObject*) overloadedMethod);
+
+    // No method is given, if only pending methods will be added
+    if (method != NULL) {
+        JOverloadedMethod_AddMethod(overloadedMethod, method);
+    }
+
+    return overloadedMethod;
+}
+
+int JOverloadedMethod_AddMethod(JPy_JOverloadedMethod* overloadedMethod, JPy_JMethod* method)
+{
+    JPy_JMethod** methods;
+
+    methods = overloadedMethod->methods;
+    PyMem_Resize(methods, JPy_JMethod*, overloadedMethod->methodCount + 1);
+    if (methods == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    overloadedMethod->methods = methods;
+    methods[overloadedMethod->methodCount] = method;
+    overloadedMethod->methodCount++;
+    Py_INCREF(method);
+
+    // New overloads may change the resolution result of this and of all overloaded methods in derived types
+    overloadedMethod->declaringClass->methodGeneration++;
+    JOverloadedMethod_ClearDispatchTable(overloadedMethod);
+    return 0;
+}
+
+/**
+ * Adds a reflected Java method or constructor, or one given by its JNI signature and method ID, which is processed
+ * into a method overload not before the overloaded method is used, see JOverloadedMethod_ResolvePendingMethods().
+ */
+int JOverloadedMethod_AddPendingMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, jobject memberRef, PyObject* signature, jmethodID mid, jboolean isStatic, jboolean isConstructor)
+{
+    JPy_PendingMethod* pendingMethods;
+    JPy_PendingMethod* pendingMethod;
+
+    pendingMethods = overloadedMethod->pendingMethods;
+    PyMem_Resize(pendingMethods, JPy_PendingMethod, overloadedMethod->pendingCount + 1);
+    if (pendingMethods == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    overloadedMethod->pendingMethods = pendingMethods;
+
+    if (memberRef != NULL) {
+        memberRef = (*jenv)->NewGlobalRef(jenv, memberRef);
+        if (memberRef == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+
+    pendingMethod = pendingMethods + overloadedMethod->pendingCount;
+    pendingMethod->memberRef = memberRef;
+    pendingMethod->signature = signature;
+    pendingMethod->mid = mid;
+    Py_XINCREF(signature);
+    pendingMethod->isStatic = isStatic;
+    pendingMethod->isConstructor = isConstructor;
+    overloadedMethod->pendingCount++;
+
+    // Same as for JOverloadedMethod_AddMethod()
+    overloadedMethod->declaringClass->methodGeneration++;
+    JOverloadedMethod_ClearDispatchTable(overloadedMethod);
+    return 0;
+}
+
+/**
+ * Processes the pending reflected Java methods of the given overloaded method into method overloads.
+ * Methods that can't be processed are rejected, as if they were not public.
+ */
+int JOverloadedMethod_ResolvePendingMethods(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod)
+{
+    JPy_PendingMethod* pendingMethods;
+    int pendingCount;
+    int i;
+
+    if (overloadedMethod->pendingCount == 0) {
+        return 0;
+    }
+
+    // Detach the pending methods first, processing them may use this overloaded method again
+    pendingMethods = overloadedMethod->pendingMethods;
+    pendingCount = overloadedMethod->pendingCount;
+    overloadedMethod->pendingMethods = NULL;
+    overloadedMethod->pendingCount = 0;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JOverloadedMethod_ResolvePendingMethods: method '%s#%s': pendingCount=%d\n",
+                   overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), pendingCount);
+
+    for (i = 0; i < pendingCount; i++) {
+        JPy_PendingMethod* pendingMethod = pendingMethods + i;
+        int result;
+        if (pendingMethod->memberRef != NULL) {
+            result = JType_ProcessReflectedMethod(jenv, overloadedMethod->declaringClass, overloadedMethod->name,
+                                                  pendingMethod->memberRef, pendingMethod->isStatic, pendingMethod->isConstructor);
+            (*jenv)->DeleteGlobalRef(jenv, pendingMethod->memberRef);
+        } else {
+            result = JType_ProcessMethodSignature(jenv, overloadedMethod->declaringClass, overloadedMethod->name,
+                                                  pendingMethod->signature, pendingMethod->isStatic, pendingMethod->isConstructor, pendingMethod->mid);
+        }
+        if (result < 0) {
+            // Don't let the rejected method fail the call
+            JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JOverloadedMethod_ResolvePendingMethods: WARNING: overload %d of Java method '%s#%s'%s%s rejected because an error occurred during method processing\n",
+                           i, overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name),
+                           pendingMethod->signature != NULL ? " with signature " : "",
+                           pendingMethod->signature != NULL ? JPy_AS_UTF8(pendingMethod->signature) : "");
+            PyErr_Clear();
+        }
+        Py_XDECREF(pendingMethod->signature);
+    }
+
+    PyMem_Del(pendingMethods);
+    return 0;
+}
+
+/**
+ * Releases the pending reflected Java methods of the given overloaded method.
+ */
+void JOverloadedMethod_ClearPendingMethods(JPy_JOverloadedMethod* overloadedMethod)
+{
+    JNIEnv* jenv;
+    int i;
+
+    if (overloadedMethod->pendingMethods == NULL) {
+        return;
+    }
+
+    jenv = JPy_GetReleaseJNIEnv();
+    for (i = 0; i < overloadedMethod->pendingCount; i++) {
+        if (overloadedMethod->pendingMethods[i].memberRef != NULL) {
+            JPy_DeleteGlobalRef(jenv, overloadedMethod->pendingMethods[i].memberRef);
+        }
+        Py_XDECREF(overloadedMethod->pendingMethods[i].signature);
+    }
+
+    PyMem_Del(overloadedMethod->pendingMethods);
+    overloadedMethod->pendingMethods = NULL;
+    overloadedMethod->pendingCount = 0;
+}
+
+/**
+ * The 'JOverloadedMethod' type's tp_dealloc slot.
+ */
+void JOverloadedMethod_dealloc(JPy_JOverloadedMethod* self)
+{
+    int i;
+
+    JOverloadedMethod_ClearCache(self);
+    JOverloadedMethod_ClearDispatchTable(self);
+    JOverloadedMethod_ClearPendingMethods(self);
+    Py_DECREF((PyObject*) self->declaringClass);
+    Py_DECREF((PyObject*) self->name);
+    for (i = 0; i < self->methodCount; i++) {
+        Py_DECREF((PyObject*) self->methods[i]);
+    }
+    PyMem_Del(self->methods);
+    Py_TYPE(self)->tp_free((PyObject*) self);
+}
+
+/**
+ * Calls the overloaded method with the given arguments. For non-static methods, the first argument is the object.
+ */
+PyObject* JOverloadedMethod_call0(JPy_JOverloadedMethod* self, int argCount, PyObject* const* pyArgs)
+{
+    JNIEnv* jenv;
+    JPy_MethodDispatchEntry entry;
+    PyObject* returnValue;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+
+    if (JOverloadedMethod_FindMethod(jenv, self, argCount, pyArgs, JNI_TRUE, &entry) == 0) {
+        returnValue = JMethod_InvokeMethod(jenv, &entry, argCount, pyArgs);
+        Py_DECREF(entry.method);
+    } else {
+        returnValue = NULL;
+    }
+
+    JPy_END_LOCAL_FRAME(jenv)
+    return returnValue;
+}
+
+/**
+ * The 'JOverloadedMethod' type's tp_call slot. Makes instances of the 'JOverloadedMethod' type callable.
+ */
+PyObject* JOverloadedMethod_call(JPy_JOverloadedMethod* self, PyObject *args, PyObject *kw)
+{
+    return JOverloadedMethod_call0(self, (int) PyTuple_GET_SIZE(args), PySequence_Fast_ITEMS(args));
+}
+
+#if defined(JPY_VECTORCALL)
+/**
+ * The 'JOverloadedMethod' type's vectorcall function. Used instead of tp_call by the interpreter, it passes
+ * the argument vector directly to method matching and argument conversion. As for tp_call, keyword arguments
+ * are ignored.
+ */
+PyObject* JOverloadedMethod_vectorcall(PyObject* self, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    return JOverloadedMethod_call0((JPy_JOverloadedMethod*) self, (int) PyVectorcall_NARGS(nargsf), args);
+}
+#endif
+
+/**
+ * Tests whether the Python types of the given arguments are the ones given by argTypes.
+ */
+int JOverloadedMethod_HasArgTypes(int argCount, PyObject* const* pyArgs, int typeCount, PyTypeObject** argTypes)
+{
+    int i;
+
+    if (typeCount < 0 || argCount != typeCount) {
+        return 0;
+    }
+    for (i = 0; i < argCount; i++) {
+        if (Py_TYPE(pyArgs[i]) != argTypes[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+PyObject* JOverloadedMethod_map0(JNIEnv* jenv, JPy_JOverloadedMethod* self, PyObject* iterator, PyObject* resultList)
+{
+    PyTypeObject* argTypes[JPy_METHOD_CACHE_MAX_ARGS];
+    JPy_MethodDispatchEntry entry;
+    const JPy_MethodDispatchEntry* cachedEntry;
+    PyObject* row;
+    PyObject* const* rowArgs;
+    PyObject* returnValue;
+    int rowArgCount;
+    int argCount;
+    int i;
+
+    entry.method = NULL;
+    argCount = -1;
+
+    while ((row = PyIter_Next(iterator)) != NULL) {
+        // Rows which are no tuples are passed as single argument
+        if (PyTuple_Check(row)) {
+            rowArgCount = (int) PyTuple_GET_SIZE(row);
+            rowArgs = PySequence_Fast_ITEMS(row);
+        } else {
+            rowArgCount = 1;
+            rowArgs = &row;
+        }
+
+        if (entry.method == NULL || !JOverloadedMethod_HasArgTypes(rowArgCount, rowArgs, argCount, argTypes)) {
+            Py_XDECREF(entry.method);
+            if (JOverloadedMethod_FindMethod(jenv, self, rowArgCount, rowArgs, JNI_TRUE, &entry) < 0) {
+                Py_DECREF(row);
+                return NULL;
+            }
+            // Only reuse the method for subsequent rows if the match depends on the argument types only,
+            // which is the case if the method has been cached for them.
+            argCount = rowArgCount;
+            cachedEntry = argCount <= JPy_METHOD_CACHE_MAX_ARGS ? JOverloadedMethod_GetCachedMethod(self, rowArgCount, rowArgs, JNI_TRUE) : NULL;
+            if (cachedEntry != NULL && cachedEntry->method == entry.method) {
+                for (i = 0; i < argCount; i++) {
+                    argTypes[i] = Py_TYPE(rowArgs[i]);
+                }
+            } else {
+                argCount = -1;
+            }
+        }
+
+        returnValue = JMethod_InvokeMethod(jenv, &entry, rowArgCount, rowArgs);
+        Py_DECREF(row);
+        if (returnValue == NULL) {
+            Py_DECREF(entry.method);
+            return NULL;
+        }
+        if (PyList_Append(resultList, returnValue) < 0) {
+            Py_DECREF(returnValue);
+            Py_DECREF(entry.method);
+            return NULL;
+        }
+        Py_DECREF(returnValue);
+    }
+
+    Py_XDECREF(entry.method);
+
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+
+    Py_INCREF(resultList);
+    return resultList;
+}
+
+/**
+ * The 'JOverloadedMethod' type's 'map' method. Calls the overloaded method once for each argument tuple
+ * of the given iterable and returns the list of return values.
+ * The method overload is only resolved again if the Python types of the arguments change from one row to the next.
+ */
+PyObject* JOverloadedMethod_map(JPy_JOverloadedMethod* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    PyObject* rows;
+    PyObject* iterator;
+    PyObject* resultList;
+    PyObject* returnValue;
+
+    if (!PyArg_ParseTuple(args, "O:map", &rows)) {
+        return NULL;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    iterator = PyObject_GetIter(rows);
+    if (iterator == NULL) {
+        return NULL;
+    }
+
+    resultList = PyList_New(0);
+    if (resultList == NULL) {
+        Py_DECREF(iterator);
+        return NULL;
+    }
+
+    if (JPy_PushLocalFrame(jenv) < 0) {
+        returnValue = NULL;
+    } else {
+        returnValue = JOverloadedMethod_map0(jenv, self, iterator, resultList);
+        JPy_END_LOCAL_FRAME(jenv)
+    }
+
+    Py_DECREF(resultList);
+    Py_DECREF(iterator);
+    return returnValue;
+}
+
+/**
+ * Returns the struct module format character and item size used for values of the given Java primitive type,
+ * or 0 if the type is not primitive.
+ */
+char JMethod_GetPrimitiveFormat(JPy_JType* type, Py_ssize_t* itemSize)
+{
+    if (type == JPy_JBoolean) {
+        *itemSize = sizeof(jboolean);
+        return '?';
+    } else if (type == JPy_JChar) {
+        *itemSize = sizeof(jchar);
+        return 'H';
+    } else if (type == JPy_JByte) {
+        *itemSize = sizeof(jbyte);
+        return 'b';
+    } else if (type == JPy_JShort) {
+        *itemSize = sizeof(jshort);
+        return 'h';
+    } else if (type == JPy_JInt) {
+        *itemSize = sizeof(jint);
+        return sizeof(int) == sizeof(jint) ? 'i' : 'l';
+    } else if (type == JPy_JLong) {
+        *itemSize = sizeof(jlong);
+        return 'q';
+    } else if (type == JPy_JFloat) {
+        *itemSize = sizeof(jfloat);
+        return 'f';
+    } else if (type == JPy_JDouble) {
+        *itemSize = sizeof(jdouble);
+        return 'd';
+    }
+    *itemSize = 0;
+    return 0;
+}
+
+/**
+ * Returns how well a column of the given buffer item format matches the given Java primitive parameter type:
+ * 2 if the items have the same representation, 1 if they are converted, and 0 if they can't be passed.
+ * Floating point items are never passed to integer parameters, and integer items are never passed to
+ * integer parameters that can't hold all of their values.
+ */
+int JMethod_MatchColumnFormat(char format, Py_ssize_t itemSize, JPy_JType* type)
+{
+    Py_ssize_t typeSize;
+    char typeFormat;
+    jboolean isFloatFormat;
+    jboolean isSignedFormat;
+
+    typeFormat = JMethod_GetPrimitiveFormat(type, &typeSize);
+    if (typeFormat == 0) {
+        return 0;
+    }
+
+    isFloatFormat = format == 'f' || format == 'd';
+    if (type == JPy_JFloat || type == JPy_JDouble) {
+        return format == typeFormat ? 2 : 1;
+    }
+    if (isFloatFormat) {
+        return 0;
+    }
+    if (type == JPy_JBoolean) {
+        return format == '?' ? 2 : 1;
+    }
+    isSignedFormat = format == 'b' || format == 'h' || format == 'i' || format == 'l' || format == 'q';
+    if (type == JPy_JChar) {
+        if (isSignedFormat || itemSize > typeSize) {
+            return 0;
+        }
+        return itemSize == typeSize ? 2 : 1;
+    }
+    if (format != '?' && (isSignedFormat ? itemSize > typeSize : itemSize >= typeSize)) {
+        return 0;
+    }
+    return isSignedFormat && itemSize == typeSize ? 2 : 1;
+}
+
+/**
+ * Tests whether all values of the given Java primitive return type can be written into items of the given buffer
+ * format. This applies the rule of JMethod_MatchColumnFormat() in reverse: floating point results are only written
+ * into floating point items at least as wide, and integer results only into items that can hold all of their values.
+ */
+int JMethod_MatchOutFormat(char format, Py_ssize_t itemSize, JPy_JType* type)
+{
+    Py_ssize_t typeSize;
+    char typeFormat;
+    jboolean isFloatFormat;
+    jboolean isSignedFormat;
+
+    typeFormat = JMethod_GetPrimitiveFormat(type, &typeSize);
+    if (typeFormat == 0) {
+        return 0;
+    }
+
+    isFloatFormat = format == 'f' || format == 'd';
+    if (type == JPy_JFloat || type == JPy_JDouble) {
+        return isFloatFormat && itemSize >= typeSize;
+    }
+    if (type == JPy_JBoolean) {
+        return 1;
+    }
+    if (isFloatFormat) {
+        // The mantissa of a floating point item must be wide enough for all integer values
+        return typeSize < itemSize;
+    }
+    if (format == '?') {
+        return 0;
+    }
+    isSignedFormat = format == 'b' || format == 'h' || format == 'i' || format == 'l' || format == 'q';
+    if (type == JPy_JChar) {
+        return isSignedFormat ? itemSize > typeSize : itemSize >= typeSize;
+    }
+    return isSignedFormat && itemSize >= typeSize;
+}
+
+#define JMethod_COLUMN_ITEM(CTYPE) (((const CTYPE*) buf)[index])
+
+/**
+ * Reads item INDEX of a native column buffer of the given format into a Java value of the given primitive type.
+ */
+void JMethod_GetColumnValue(const void* buf, char format, Py_ssize_t index, JPy_JType* type, jvalue* value)
+{
+    jlong l = 0;
+    jdouble d = 0.0;
+    jboolean isFloat = JNI_FALSE;
+
+    switch (format) {
+        case 'b': l = (jlong) JMethod_COLUMN_ITEM(signed char); break;
+        case '?':
+        case 'B': l = (jlong) JMethod_COLUMN_ITEM(unsigned char); break;
+        case 'h': l = (jlong) JMethod_COLUMN_ITEM(short); break;
+        case 'H': l = (jlong) JMethod_COLUMN_ITEM(unsigned short); break;
+        case 'i': l = (jlong) JMethod_COLUMN_ITEM(int); break;
+        case 'I': l = (jlong) JMethod_COLUMN_ITEM(unsigned int); break;
+        case 'l': l = (jlong) JMethod_COLUMN_ITEM(long); break;
+        case 'L': l = (jlong) JMethod_COLUMN_ITEM(unsigned long); break;
+        case 'q': l = (jlong) JMethod_COLUMN_ITEM(long long); break;
+        case 'Q': l = (jlong) JMethod_COLUMN_ITEM(unsigned long long); break;
+        case 'f': d = (jdouble) JMethod_COLUMN_ITEM(float); isFloat = JNI_TRUE; break;
+        case 'd': d = JMethod_COLUMN_ITEM(double); isFloat = JNI_TRUE; break;
+    }
+
+    if (type == JPy_JDouble) {
+        value->d = isFloat ? d : (jdouble) l;
+    } else if (type == JPy_JFloat) {
+        value->f = isFloat ? (jfloat) d : (jfloat) l;
+    } else if (type == JPy_JLong) {
+        value->j = l;
+    } else if (type == JPy_JInt) {
+        value->i = (jint) l;
+    } else if (type == JPy_JShort) {
+        value->s = (jshort) l;
+    } else if (type == JPy_JByte) {
+        value->b = (jbyte) l;
+    } else if (type == JPy_JChar) {
+        value->c = (jchar) l;
+    } else {
+        value->z = (jboolean) (l != 0);
+    }
+}
+
+#define JMethod_SET_COLUMN_ITEM(CTYPE) ((CTYPE*) buf)[index] = isFloat ? (CTYPE) d : (CTYPE) l
+
+/**
+ * Writes a Java value of the given primitive type into item INDEX of a native column buffer of the given format.
+ */
+void JMethod_SetColumnValue(void* buf, char format, Py_ssize_t index, JPy_JType* type, const jvalue* value)
+{
+    jlong l = 0;
+    jdouble d = 0.0;
+    jboolean isFloat = JNI_FALSE;
+
+    if (type == JPy_JDouble) {
+        d = value->d;
+        isFloat = JNI_TRUE;
+    } else if (type == JPy_JFloat) {
+        d = value->f;
+        isFloat = JNI_TRUE;
+    } else if (type == JPy_JLong) {
+        l = value->j;
+    } else if (type == JPy_JInt) {
+        l = value->i;
+    } else if (type == JPy_JShort) {
+        l = value->s;
+    } else if (type == JPy_JByte) {
+        l = value->b;
+    } else if (type == JPy_JChar) {
+        l = value->c;
+    } else {
+        l = value->z;
+    }
+
+    switch (format) {
+        case 'b': JMethod_SET_COLUMN_ITEM(signed char); break;
+        case '?':
+        case 'B': JMethod_SET_COLUMN_ITEM(unsigned char); break;
+        case 'h': JMethod_SET_COLUMN_ITEM(short); break;
+        case 'H': JMethod_SET_COLUMN_ITEM(unsigned short); break;
+        case 'i': JMethod_SET_COLUMN_ITEM(int); break;
+        case 'I': JMethod_SET_COLUMN_ITEM(unsigned int); break;
+        case 'l': JMethod_SET_COLUMN_ITEM(long); break;
+        case 'L': JMethod_SET_COLUMN_ITEM(unsigned long); break;
+        case 'q': JMethod_SET_COLUMN_ITEM(long long); break;
+        case 'Q': JMethod_SET_COLUMN_ITEM(unsigned long long); break;
+        case 'f': JMethod_SET_COLUMN_ITEM(float); break;
+        case 'd': JMethod_SET_COLUMN_ITEM(double); break;
+    }
+}
+
+#define JMethod_CALL_PRIMITIVE_METHOD(NAME, FIELD) \
+    result->FIELD = method->isStatic \
+        ? (*jenv)->CallStatic##NAME##MethodA(jenv, method->declaringClass->classRef, method->mid, jArgs) \
+        : (*jenv)->Call##NAME##MethodA(jenv, objectRef, method->mid, jArgs)
+
+/**
+ * Calls a Java method with primitive or void return type without converting its return value into a Python object.
+ */
+void JMethod_CallPrimitiveMethod(JNIEnv* jenv, JPy_JMethod* method, jobject objectRef, jvalue* jArgs, jvalue* result)
+{
+    JPy_JType* returnType = method->returnDescriptor->type;
+
+    if (returnType == JPy_JDouble) {
+        JMethod_CALL_PRIMITIVE_METHOD(Double, d);
+    } else if (returnType == JPy_JFloat) {
+        JMethod_CALL_PRIMITIVE_METHOD(Float, f);
+    } else if (returnType == JPy_JLong) {
+        JMethod_CALL_PRIMITIVE_METHOD(Long, j);
+    } else if (returnType == JPy_JInt) {
+        JMethod_CALL_PRIMITIVE_METHOD(Int, i);
+    } else if (returnType == JPy_JShort) {
+        JMethod_CALL_PRIMITIVE_METHOD(Short, s);
+    } else if (returnType == JPy_JByte) {
+        JMethod_CALL_PRIMITIVE_METHOD(Byte, b);
+    } else if (returnType == JPy_JChar) {
+        JMethod_CALL_PRIMITIVE_METHOD(Char, c);
+    } else if (returnType == JPy_JBoolean) {
+        JMethod_CALL_PRIMITIVE_METHOD(Boolean, z);
+    } else if (method->isStatic) {
+        (*jenv)->CallStaticVoidMethodA(jenv, method->declaringClass->classRef, method->mid, jArgs);
+    } else {
+        (*jenv)->CallVoidMethodA(jenv, objectRef, method->mid, jArgs);
+    }
+}
+
+/**
+ * Finds the method overload with primitive parameters and a primitive or void return type that best matches
+ * the given column formats. Overloads of super classes are considered as well.
+ * Returns a borrowed reference or NULL, if no or more than one best matching overload exists.
+ */
+JPy_JMethod* JOverloadedMethod_FindColumnMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, jboolean isStatic, int columnCount, const Py_buffer* columns, const char* formats)
+{
+    JPy_MethodDispatchEntry* entries;
+    JPy_MethodDispatchEntry* entry;
+    JPy_JMethod* bestMethod;
+    JPy_JMethod* method;
+    Py_ssize_t itemSize;
+    int entryCount;
+    int bestMatchValue;
+    int bestMatchCount;
+    int matchValue;
+    int columnMatch;
+    int i, j;
+
+    if (JOverloadedMethod_GetDispatchEntries(jenv, overloadedMethod, isStatic ? columnCount : columnCount + 1, &entries, &entryCount) < 0) {
+        return NULL;
+    }
+
+    bestMethod = NULL;
+    bestMatchValue = 0;
+    bestMatchCount = 0;
+
+    for (i = 0; i < entryCount; i++) {
+        entry = entries + i;
+        method = entry->method;
+        if (entry->isStatic != isStatic || entry->paramCount != columnCount || method->returnDescriptor == NULL
+            || !(method->returnDescriptor->type == JPy_JVoid || JMethod_GetPrimitiveFormat(method->returnDescriptor->type, &itemSize) != 0)) {
+            continue;
+        }
+        matchValue = 1;
+        for (j = 0; j < columnCount; j++) {
+            columnMatch = JMethod_MatchColumnFormat(formats[j], columns[j].itemsize, entry->paramDescriptors[j].type);
+            if (columnMatch == 0) {
+                matchValue = 0;
+                break;
+            }
+            matchValue += columnMatch;
+        }
+        if (matchValue > bestMatchValue) {
+            bestMethod = method;
+            bestMatchValue = matchValue;
+            bestMatchCount = 1;
+        } else if (matchValue > 0 && matchValue == bestMatchValue) {
+            bestMatchCount++;
+        }
+    }
+
+    if (bestMethod == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "no matching Java method overload with primitive parameters found for the given columns");
+        return NULL;
+    } else if (bestMatchCount > 1) {
+        PyErr_SetString(PyExc_RuntimeError, "ambiguous Java method call, too many matching method overloads found for the given columns");
+        return NULL;
+    }
+    return bestMethod;
+}
+
+#define JMethod_NEW_ARRAY_FROM_COLUMN(NAME, JTYPE) \
+    arrayRef = (*jenv)->New##NAME##Array(jenv, (jsize) rowCount); \
+    if (arrayRef != NULL) { \
+        (*jenv)->Set##NAME##ArrayRegion(jenv, arrayRef, 0, (jsize) rowCount, (const JTYPE*) outBuf); \
+    }
+
+PyObject* JOverloadedMethod_call_many0(JNIEnv* jenv, JPy_JOverloadedMethod* self, PyObject* instance, int columnCount, Py_buffer* columns, const char* formats, Py_ssize_t rowCount, PyObject* out)
+{
+    JPy_JMethod* method;
+    JPy_JType* returnType;
+    jobject objectRef;
+    jvalue* jArgs;
+    jvalue result;
+    Py_buffer outView;
+    void* outBuf;
+    char outFormat;
+    Py_ssize_t outItemSize;
+    jarray arrayRef;
+    PyObject* returnValue;
+    Py_ssize_t row;
+    int j;
+
+    method = JOverloadedMethod_FindColumnMethod(jenv, self, (jboolean) (instance == NULL), columnCount, columns, formats);
+    if (method == NULL) {
+        return NULL;
+    }
+
+    objectRef = NULL;
+    if (instance != NULL) {
+        objectRef = ((JPy_JObj*) instance)->objectRef;
+        if (!(*jenv)->IsInstanceOf(jenv, objectRef, method->declaringClass->classRef)) {
+            PyErr_Format(PyExc_TypeError, "call_many: argument 1 must be an instance of '%s'", method->declaringClass->javaName);
+            return NULL;
+        }
+    }
+
+    returnType = method->returnDescriptor->type;
+    outBuf = NULL;
+    outFormat = 0;
+    outView.obj = NULL;
+
+    if (returnType == JPy_JVoid) {
+        if (out != NULL && out != Py_None) {
+            PyErr_SetString(PyExc_ValueError, "call_many: 'out' must not be given for methods returning void");
+            return NULL;
+        }
+    } else if (out != NULL && out != Py_None) {
+        if (PyObject_GetBuffer(out, &outView, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0) {
+            return NULL;
+        }
+        outFormat = JType_GetBufferFormatChar(&outView);
+        if (outFormat == 0 || !JMethod_MatchOutFormat(outFormat, outView.itemsize, returnType)) {
+            PyBuffer_Release(&outView);
+            PyErr_SetString(PyExc_TypeError, "call_many: 'out' must be a writable, one-dimensional buffer of a native format that can hold all values of the method's return type");
+            return NULL;
+        }
+        if (outView.len / outView.itemsize < rowCount) {
+            PyBuffer_Release(&outView);
+            PyErr_SetString(PyExc_ValueError, "call_many: 'out' is too small for the number of rows");
+            return NULL;
+        }
+        outBuf = outView.buf;
+    } else {
+        if (rowCount > 0x7fffffff) {
+            PyErr_SetString(PyExc_ValueError, "call_many: too many rows for a Java array");
+            return NULL;
+        }
+        outFormat = JMethod_GetPrimitiveFormat(returnType, &outItemSize);
+        outBuf = PyMem_Malloc(rowCount > 0 ? rowCount * outItemSize : 1);
+        if (outBuf == NULL) {
+            return PyErr_NoMemory();
+        }
+    }
+
+    jArgs = PyMem_New(jvalue, columnCount > 0 ? columnCount : 1);
+    if (jArgs == NULL) {
+        returnValue = PyErr_NoMemory();
+        goto error;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JOverloadedMethod_call_many: calling %sJava method %s#%s for %ld rows\n", method->isStatic ? "static " : "", method->declaringClass->javaName, JPy_AS_UTF8(method->name), (long) rowCount);
+
+    JMethod_BEGIN_JAVA_CALL(method)
+    for (row = 0; row < rowCount; row++) {
+        for (j = 0; j < columnCount; j++) {
+            JMethod_GetColumnValue(columns[j].buf, formats[j], row, method->paramDescriptors[j].type, jArgs + j);
+        }
+        JMethod_CallPrimitiveMethod(jenv, method, objectRef, jArgs, &result);
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            break;
+        }
+        if (outBuf != NULL) {
+            JMethod_SetColumnValue(outBuf, outFormat, row, returnType, &result);
+        }
+    }
+    JMethod_END_JAVA_CALL
+
+    PyMem_Del(jArgs);
+
+    if ((*jenv)->ExceptionCheck(jenv)) {
+        JPy_HandleJavaException(jenv);
+        returnValue = NULL;
+        goto error;
+    }
+
+    if (returnType == JPy_JVoid) {
+        returnValue = JPy_FROM_JVOID();
+    } else if (outView.obj != NULL) {
+        Py_INCREF(out);
+        returnValue = out;
+    } else {
+        if (returnType == JPy_JBoolean) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Boolean, jboolean)
+        } else if (returnType == JPy_JChar) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Char, jchar)
+        } else if (returnType == JPy_JByte) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Byte, jbyte)
+        } else if (returnType == JPy_JShort) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Short, jshort)
+        } else if (returnType == JPy_JInt) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Int, jint)
+        } else if (returnType == JPy_JLong) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Long, jlong)
+        } else if (returnType == JPy_JFloat) {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Float, jfloat)
+        } else {
+            JMethod_NEW_ARRAY_FROM_COLUMN(Double, jdouble)
+        }
+        if (arrayRef == NULL || (*jenv)->ExceptionCheck(jenv)) {
+            JPy_HandleJavaException(jenv);
+            returnValue = NULL;
+            goto error;
+        }
+        returnValue = (PyObject*) JObj_New(jenv, arrayRef);
+        (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    }
+
+error:
+    if (outView.obj != NULL) {
+        PyBuffer_Release(&outView);
+    } else {
+        PyMem_Free(outBuf);
+    }
+    return returnValue;
+}
+
+/**
+ * The 'JOverloadedMethod' type's 'call_many' method. Calls a Java method with primitive parameters once for each
+ * row of the given columns, which are one-dimensional Python buffers such as numpy arrays. For non-static methods,
+ * the first argument is the Java object the method is called on. The return values are written into the buffer
+ * given by the 'out' keyword, or into a new Java primitive array.
+ */
+PyObject* JOverloadedMethod_call_many(JPy_JOverloadedMethod* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    PyObject* instance;
+    PyObject* out;
+    PyObject* returnValue;
+    Py_buffer* columns;
+    char* formats;
+    Py_ssize_t argCount;
+    Py_ssize_t rowCount;
+    int columnCount;
+    int i0;
+    int j;
+
+    out = NULL;
+    if (kwds != NULL) {
+        out = PyDict_GetItemString(kwds, "out");
+        if (PyDict_Size(kwds) != (out != NULL ? 1 : 0)) {
+            PyErr_SetString(PyExc_TypeError, "call_many: only the keyword argument 'out' is supported");
+            return NULL;
+        }
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    argCount = PyTuple_GET_SIZE(args);
+    instance = NULL;
+    i0 = 0;
+    if (argCount > 0 && JObj_Check(PyTuple_GET_ITEM(args, 0)) && !PyObject_CheckBuffer(PyTuple_GET_ITEM(args, 0))) {
+        instance = PyTuple_GET_ITEM(args, 0);
+        i0 = 1;
+    }
+
+    columnCount = (int) (argCount - i0);
+    columns = PyMem_New(Py_buffer, columnCount > 0 ? columnCount : 1);
+    formats = PyMem_New(char, columnCount > 0 ? columnCount : 1);
+    if (columns == NULL || formats == NULL) {
+        PyMem_Del(columns);
+        PyMem_Del(formats);
+        return PyErr_NoMemory();
+    }
+
+    rowCount = 0;
+    returnValue = NULL;
+    for (j = 0; j < columnCount; j++) {
+        if (PyObject_GetBuffer(PyTuple_GET_ITEM(args, i0 + j), columns + j, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+            goto error;
+        }
+        formats[j] = JType_GetBufferFormatChar(columns + j);
+        if (formats[j] == 0) {
+            PyErr_Format(PyExc_TypeError, "call_many: argument %d must be a one-dimensional buffer of a native numeric format", i0 + j + 1);
+            j++;
+            goto error;
+        }
+        if (j == 0) {
+            rowCount = columns[j].len / columns[j].itemsize;
+        } else if (columns[j].len / columns[j].itemsize != rowCount) {
+            PyErr_SetString(PyExc_ValueError, "call_many: all columns must have the same length");
+            j++;
+            goto error;
+        }
+    }
+
+    if (columnCount == 0) {
+        PyErr_SetString(PyExc_ValueError, "call_many: at least one column is required");
+        goto error;
+    }
+
+    returnValue = JOverloadedMethod_call_many0(jenv, self, instance, columnCount, columns, formats, rowCount, out);
+
+error:
+    // Release the buffers obtained so far
+    while (--j >= 0) {
+        PyBuffer_Release(columns + j);
+    }
+    PyMem_Del(columns);
+    PyMem_Del(formats);
+    return returnValue;
+}
+
+/**
+ * The 'JOverloadedMethod' type's tp_descr_get slot. Binds the method to the object it is accessed on,
+ * so that a method call to an instance x of class X becomes: x.m() --> X.m(x).
+ * If accessed on the class, the unbound method is returned.
+ */
+PyObject* JOverloadedMethod_descr_get(PyObject* self, PyObject* obj, PyObject* type)
+{
+    if (obj == NULL || obj == Py_None) {
+        Py_INCREF(self);
+        return self;
+    }
+#if defined(JPY_COMPAT_33P)
+    return PyMethod_New(self, obj);
+#elif defined(JPY_COMPAT_27)
+    return PyMethod_New(self, obj, type);
+#else
+#error JPY_VERSION_ERROR
+#endif
+}
+
+static PyMethodDef JOverloadedMethod_methods[] =
+{
+    {"map", (PyCFunction) JOverloadedMethod_map, METH_VARARGS, "Calls the method for each argument tuple of the given iterable and returns the list of return values"},
+    {"call_many", (PyCFunction) JOverloadedMethod_call_many, METH_VARARGS | METH_KEYWORDS, "Calls a method with primitive parameters for each row of the given buffer columns"},
+    {NULL}  /* Sentinel */
+};
+
+/**
+ * The 'JOverloadedMethod' type's tp_repr slot.
  */
 PyObject* JOverloadedMethod_repr(JPy_JOverloadedMethod* self)
 {
     const char* className = self->declaringClass->javaName;
     const char* name = JPy_AS_UTF8(self->name);
-    int methodCount = PyList_Size(self->methodList);
+    int methodCount = self->methodCount + self->pendingCount;
     return JPy_FROM_FORMAT("%s(class='%s', name='%s', methodCount=%d)",
                            ((PyObject*)self)->ob_type->tp_name,
                            className,
@@ -825,7 +2143,42 @@ static PyMemberDef JOverloadedMethod_members[] =
 {
     {"decl_class",   T_OBJECT_EX, offsetof(JPy_JOverloadedMethod, declaringClass), READONLY, "Declaring Java class"},
     {"name",         T_OBJECT_EX, offsetof(JPy_JOverloadedMethod, name),           READONLY, "Overloaded method name"},
-    {"methods",      T_OBJECT_EX, offsetof(JPy_JOverloadedMethod, methodList),     READONLY, "List of methods"},
+    {"cache_hits",   T_PYSSIZET,  offsetof(JPy_JOverloadedMethod, cacheHits),      READONLY, "Number of calls whose method overload was taken from the cache"},
+    {"cache_misses", T_PYSSIZET,  offsetof(JPy_JOverloadedMethod, cacheMisses),    READONLY, "Number of calls whose method overload had to be matched"},
+    {NULL}  /* Sentinel */
+};
+
+/**
+ * Getter for the 'methods' attribute of the 'JOverloadedMethod' type. Processes pending methods first.
+ * Returns a new list of the method overloads.
+ */
+PyObject* JOverloadedMethod_get_methods(JPy_JOverloadedMethod* self, void* closure)
+{
+    JNIEnv* jenv;
+    PyObject* methodList;
+    int i;
+
+    if (self->pendingCount > 0) {
+        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+        JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+        JOverloadedMethod_ResolvePendingMethods(jenv, self);
+        JPy_END_LOCAL_FRAME(jenv)
+    }
+
+    methodList = PyList_New(self->methodCount);
+    if (methodList == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < self->methodCount; i++) {
+        Py_INCREF(self->methods[i]);
+        PyList_SET_ITEM(methodList, i, (PyObject*) self->methods[i]);
+    }
+    return methodList;
+}
+
+static PyGetSetDef JOverloadedMethod_getset[] =
+{
+    {"methods", (getter) JOverloadedMethod_get_methods, NULL, "List of methods", NULL},
     {NULL}  /* Sentinel */
 };
 
@@ -838,13 +2191,29 @@ PyObject* JOverloadedMethod_str(JPy_JOverloadedMethod* self)
     return self->name;
 }
 
+/**
+ * On Python 3.8+, instances of method descriptor types are called with the object as first argument instead of
+ * being bound to it first, which saves the creation of a bound method object for each method call.
+ */
+#if defined(JPY_VECTORCALL)
+#define JOverloadedMethod_TPFLAGS (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_METHOD_DESCRIPTOR | Py_TPFLAGS_HAVE_VECTORCALL)
+#elif defined(Py_TPFLAGS_METHOD_DESCRIPTOR)
+#define JOverloadedMethod_TPFLAGS (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_METHOD_DESCRIPTOR)
+#else
+#define JOverloadedMethod_TPFLAGS Py_TPFLAGS_DEFAULT
+#endif
+
 PyTypeObject JOverloadedMethod_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
     "jpy.JOverloadedMethod",                /* tp_name */
     sizeof (JPy_JOverloadedMethod),         /* tp_basicsize */
     0,                            /* tp_itemsize */
     (destructor)JOverloadedMethod_dealloc,  /* tp_dealloc */
+#if defined(JPY_VECTORCALL)
+    offsetof(JPy_JOverloadedMethod, vectorcall), /* tp_vectorcall_offset */
+#else
     NULL,                         /* tp_print */
+#endif
     NULL,                         /* tp_getattr */
     NULL,                         /* tp_setattr */
     NULL,                         /* tp_reserved */
@@ -858,7 +2227,7 @@ PyTypeObject JOverloadedMethod_Type = {
     NULL,                         /* tp_getattro */
     NULL,                         /* tp_setattro */
     NULL,                         /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT,           /* tp_flags */
+    JOverloadedMethod_TPFLAGS,    /* tp_flags */
     "Java Overloaded Method",     /* tp_doc */
     NULL,                         /* tp_traverse */
     NULL,                         /* tp_clear */
@@ -866,12 +2235,12 @@ PyTypeObject JOverloadedMethod_Type = {
     0,                            /* tp_weaklistoffset */
     NULL,                         /* tp_iter */
     NULL,                         /* tp_iternext */
-    NULL,                         /* tp_methods */
+    JOverloadedMethod_methods,    /* tp_methods */
     JOverloadedMethod_members,    /* tp_members */
-    NULL,                         /* tp_getset */
+    JOverloadedMethod_getset,     /* tp_getset */
     NULL,                         /* tp_base */
     NULL,                         /* tp_dict */
-    NULL,                         /* tp_descr_get */
+    JOverloadedMethod_descr_get,  /* tp_descr_get */
     NULL,                         /* tp_descr_set */
     0,                            /* tp_dictoffset */
     NULL,                         /* tp_init */
@@ -23,10 +23,19 @@ extern "C" {
 
 #include "jpy_compat.h"
 
+struct JPy_JMethod;
+struct JPy_MethodDispatchEntry;
+
+/**
+ * Calls the Java method of the given dispatch entry with the already converted Java arguments and converts its
+ * return value. Returns NULL and sets a Python exception if the call fails.
+ */
+typedef PyObject* (*JPy_InvokeMethod)(JNIEnv*, const struct JPy_MethodDispatchEntry*, PyObject* const*, jvalue*);
+
 /**
  * Python object representing a Java method. It's type is 'JMethod'.
  */
-typedef struct
+typedef struct JPy_JMethod
 {
     PyObject_HEAD
 
@@ -38,12 +47,16 @@ typedef struct
     int paramCount;
     // Method is static?
     char isStatic;
+    // Release the Python GIL while the Java method is executing?
+    char releaseGIL;
     // Method parameter types. Will be NULL, if parameter_count == 0.
     JPy_ParamDescriptor* paramDescriptors;
     // Method return type. Will be NULL for constructors.
     JPy_ReturnDescriptor* returnDescriptor;
     // The JNI method ID obtained from the declaring class.
     jmethodID mid;
+    // Invokes the method, selected by return type. Will be NULL for constructors.
+    JPy_InvokeMethod InvokeMethod;
 }
 JPy_JMethod;
 
@@ -52,6 +65,94 @@ JPy_JMethod;
  */
 extern PyTypeObject JMethod_Type;
 
+/**
+ * Releases the Python GIL before a Java method is called, if configured for the given METHOD or globally.
+ * Must be followed by JMethod_END_JAVA_CALL. No Python API functions must be used in between.
+ */
+#define JMethod_BEGIN_JAVA_CALL(METHOD) \
+    { \
+        PyThreadState* _threadState = ((METHOD)->releaseGIL || JPy_ReleaseGIL) ? PyEval_SaveThread() : NULL;
+
+/**
+ * Re-acquires the Python GIL after a Java method call, if it has been released by JMethod_BEGIN_JAVA_CALL.
+ */
+#define JMethod_END_JAVA_CALL \
+        if (_threadState != NULL) { \
+            PyEval_RestoreThread(_threadState); \
+        } \
+    }
+
+/**
+ * Number of entries in the method cache of an overloaded method.
+ */
+#define JPy_METHOD_CACHE_SIZE 4
+/**
+ * Maximum number of call arguments (including 'self') for which resolved methods are cached.
+ */
+#define JPy_METHOD_CACHE_MAX_ARGS 8
+
+/**
+ * An entry of the dispatch table of an overloaded method. It holds the members of the method overload used to match
+ * and invoke it, so that the entries of a table can be scanned without accessing the method objects.
+ */
+typedef struct JPy_MethodDispatchEntry
+{
+    // The method overload (new reference). It owns the parameter descriptors.
+    JPy_JMethod* method;
+    // The method's declaring class.
+    JPy_JType* declaringClass;
+    // The method's parameter types. Will be NULL, if paramCount == 0.
+    JPy_ParamDescriptor* paramDescriptors;
+    // The method's JNI method ID.
+    jmethodID mid;
+    // Invokes the method, selected by return type. Will be NULL for constructors.
+    JPy_InvokeMethod InvokeMethod;
+    // The method's parameter count.
+    int paramCount;
+    // Method is static?
+    char isStatic;
+    // Distance of the method's declaring class from the overloaded method's declaring class, 0 for its own overloads.
+    int level;
+}
+JPy_MethodDispatchEntry;
+
+/**
+ * An entry of the method cache of an overloaded method. It maps the Python types of the call arguments
+ * to the method overload resolved for them.
+ */
+typedef struct
+{
+    // Number of call arguments, -1 if the entry is unused.
+    int argCount;
+    // Whether overloads of super classes have been considered.
+    jboolean visitSuperClass;
+    // Python types of the call arguments (new references).
+    PyTypeObject* argTypes[JPy_METHOD_CACHE_MAX_ARGS];
+    // Copy of the dispatch entry of the resolved method (its method is a new reference), or all NULL if unused.
+    JPy_MethodDispatchEntry dispatchEntry;
+}
+JPy_MethodCacheEntry;
+
+/**
+ * A Java method or constructor of an overloaded method that has not been processed into a method
+ * overload yet, see JOverloadedMethod_ResolvePendingMethods(). It is given either by its reflected
+ * member or by its JNI signature and method ID, if it was taken from the type metadata, see jpy.set_type_metadata().
+ */
+typedef struct
+{
+    // The java.lang.reflect.Method or java.lang.reflect.Constructor object (global reference), or NULL.
+    jobject memberRef;
+    // The method's JNI signature, e.g. "(ILjava/lang/String;)V" (new reference), or NULL.
+    PyObject* signature;
+    // The method ID, if signature is given.
+    jmethodID mid;
+    // Whether the method is static. Constructors are treated as static methods.
+    jboolean isStatic;
+    // Whether memberRef is a constructor.
+    jboolean isConstructor;
+}
+JPy_PendingMethod;
+
 /**
  * Python object representing an overloaded Java method. It's type is 'JOverloadedMethod'.
  */
@@ -63,8 +164,41 @@ typedef struct
     JPy_JType* declaringClass;
     // Method name.
     PyObject* name;
-    // List of method overloads (a PyList with items of type JPy_JMethod).
-    PyObject* methodList;
+    // Array of method overloads (new references). The Python list returned by the 'methods' attribute is created from
+    // it on demand.
+    JPy_JMethod** methods;
+    // Number of method overloads.
+    int methodCount;
+    // Reflected Java methods still to be processed into overloads, these are only processed on first use.
+    JPy_PendingMethod* pendingMethods;
+    // Number of pending methods.
+    int pendingCount;
+    // Methods resolved for recently used argument type signatures.
+    JPy_MethodCacheEntry cache[JPy_METHOD_CACHE_SIZE];
+    // Index of the cache entry to be replaced next.
+    int cacheNext;
+    // Number of method lookups answered by the cache.
+    Py_ssize_t cacheHits;
+    // Number of method lookups that required overload matching.
+    Py_ssize_t cacheMisses;
+    // The overloads of this and of the super classes' overloaded methods of the same name without those overridden
+    // in derived classes, grouped by the number of Python arguments they accept and ordered by level within each group,
+    // see JOverloadedMethod_BuildDispatchTable(). The cache entries are only valid for the current dispatch table.
+    JPy_MethodDispatchEntry* dispatchEntries;
+    // Start index of the group of dispatch entries for each argument count, plus the end index of the last group.
+    int* dispatchStarts;
+    // Largest number of Python arguments accepted by any overload in the dispatch table, -1 if there is none.
+    int dispatchMaxArgCount;
+    // Sum of the method generations of the declaring class and its super classes the dispatch table is valid for,
+    // if not final, see JOverloadedMethod_GetChainGeneration().
+    int dispatchGeneration;
+    // Whether the dispatch table has been built after the declaring class and all of its super classes were resolved.
+    // Then it can't change anymore.
+    jboolean dispatchFinal;
+#if defined(JPY_VECTORCALL)
+    // The vectorcall function, see JOverloadedMethod_vectorcall().
+    vectorcallfunc vectorcall;
+#endif
 }
 JPy_JOverloadedMethod;
 
@@ -73,10 +207,13 @@ JPy_JOverloadedMethod;
  */
 extern PyTypeObject JOverloadedMethod_Type;
 
-JPy_JMethod*           JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* argTuple, jboolean visitSuperClass);
+int                    JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* args, jboolean visitSuperClass, JPy_MethodDispatchEntry* entry);
 JPy_JMethod*           JOverloadedMethod_FindStaticMethod(JPy_JOverloadedMethod* overloadedMethod, PyObject* argTuple);
 JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject* name, JPy_JMethod* method);
 int                    JOverloadedMethod_AddMethod(JPy_JOverloadedMethod* overloadedMethod, JPy_JMethod* method);
+int                    JOverloadedMethod_AddPendingMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, jobject memberRef, PyObject* signature, jmethodID mid, jboolean isStatic, jboolean isConstructor);
+int                    JOverloadedMethod_ResolvePendingMethods(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod);
+void                   JOverloadedMethod_ClearCache(JPy_JOverloadedMethod* overloadedMethod);
 
 JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
                          PyObject* name,
@@ -87,10 +224,17 @@ JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
                          jmethodID mid);
 
 void JMethod_Del(JPy_JMethod* method);
+void JMethod_InitInvokeMethod(JPy_JMethod* method);
 
 int JMethod_ConvertToJavaValues(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* argTuple, jvalue* jArgs);
 
-int  JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* jMethod, PyObject* argTuple, jvalue** jValues, JPy_ArgDisposer** jDisposers);
+/**
+ * Maximum number of method parameters for which JMethod_CreateJArgs() uses the caller-provided buffers
+ * instead of allocating the Java argument values and disposers on the heap.
+ */
+#define JPy_JARGS_BUFFER_SIZE 8
+
+int  JMethod_CreateJArgs(JNIEnv* jenv, const JPy_MethodDispatchEntry* entry, int argCount, PyObject* const* args, jvalue* jValuesBuffer, JPy_ArgDisposer* jDisposersBuffer, jvalue** jValues, JPy_ArgDisposer** jDisposers);
 void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jValues, JPy_ArgDisposer* jDisposers);
 
 #ifdef __cplusplus
@@ -17,6 +17,7 @@
 #include "jpy_module.h"
 #include "jpy_diag.h"
 #include "jpy_jarray.h"
+#include "jpy_jbuffer.h"
 #include "jpy_jtype.h"
 #include "jpy_jobj.h"
 #include "jpy_jmethod.h"
@@ -61,27 +62,47 @@ JPy_JObj* JObj_FromType(JNIEnv* jenv, JPy_JType* type, jobject objectRef)
 
         array = (JPy_JArray*) obj;
         array->bufferExportCount = 0;
+        array->exportCritical = JNI_FALSE;
     }
 
     return obj;
 }
 
+int JObj_init0(JNIEnv* jenv, JPy_JObj* self, int argCount, PyObject* const* args);
+
 /**
  * The JObj type's tp_init slot. Called when the type is used to create new instances (constructor).
+ * Java constructors have no named parameters, so keyword arguments are rejected.
  */
 int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
 {
     JNIEnv* jenv;
+    int result;
+
+    if (kwds != NULL && PyDict_Size(kwds) > 0) {
+        PyErr_SetString(PyExc_TypeError, "Java constructors do not accept keyword arguments");
+        return -1;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+    JPy_BEGIN_LOCAL_FRAME(jenv, -1)
+    result = JObj_init0(jenv, self, (int) PyTuple_GET_SIZE(args), PySequence_Fast_ITEMS(args));
+    JPy_END_LOCAL_FRAME(jenv)
+    return result;
+}
+
+int JObj_init0(JNIEnv* jenv, JPy_JObj* self, int argCount, PyObject* const* args)
+{
     PyTypeObject* type;
     JPy_JType* jType;
     PyObject* constructor;
-    JPy_JMethod* jMethod;
+    JPy_MethodDispatchEntry entry;
     jobject objectRef;
+    jvalue jArgsBuffer[JPy_JARGS_BUFFER_SIZE];
+    JPy_ArgDisposer jDisposersBuffer[JPy_JARGS_BUFFER_SIZE];
     jvalue* jArgs;
     JPy_ArgDisposer* jDisposers;
 
-    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
-
     type = ((PyObject*) self)->ob_type;
 
     constructor = PyDict_GetItemString(type->tp_dict, JPy_JTYPE_ATTR_NAME_JINIT);
@@ -101,18 +122,26 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
         return -1;
     }
 
-    jMethod = JOverloadedMethod_FindMethod(jenv, (JPy_JOverloadedMethod*) constructor, args, JNI_FALSE);
-    if (jMethod == NULL) {
+    if (JOverloadedMethod_FindMethod(jenv, (JPy_JOverloadedMethod*) constructor, argCount, args, JNI_FALSE, &entry) < 0) {
         return -1;
     }
 
-    if (JMethod_CreateJArgs(jenv, jMethod, args, &jArgs, &jDisposers) < 0) {
+    if (JMethod_CreateJArgs(jenv, &entry, argCount, args, jArgsBuffer, jDisposersBuffer, &jArgs, &jDisposers) < 0) {
+        Py_DECREF(entry.method);
         return -1;
     }
 
     JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JObj_init: calling Java constructor %s\n", jType->javaName);
 
-    objectRef = (*jenv)->NewObjectA(jenv, jType->classRef, jMethod->mid, jArgs);
+    JMethod_BEGIN_JAVA_CALL(entry.method)
+    objectRef = (*jenv)->NewObjectA(jenv, jType->classRef, entry.mid, jArgs);
+    JMethod_END_JAVA_CALL
+
+    if (entry.paramCount > 0) {
+        JMethod_DisposeJArgs(jenv, entry.paramCount, jArgs, jDisposers);
+    }
+    Py_DECREF(entry.method);
+
     JPy_ON_JAVA_EXCEPTION_RETURN(-1);
 
     if (objectRef == NULL) {
@@ -120,10 +149,6 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
         return -1;
     }
 
-    if (jMethod->paramCount > 0) {
-        JMethod_DisposeJArgs(jenv, jMethod->paramCount, jArgs, jDisposers);
-    }
-
     objectRef = (*jenv)->NewGlobalRef(jenv, objectRef);
     if (objectRef == NULL) {
         PyErr_NoMemory();
@@ -142,6 +167,97 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
     return 0;
 }
 
+#if defined(JPY_VECTORCALL)
+/**
+ * Creates a new instance of the given type the regular way, by calling its meta type with an argument tuple
+ * and a keyword dictionary created from the given argument vector.
+ */
+PyObject* JObj_CallType(PyObject* type, PyObject* const* args, int argCount, PyObject* kwnames)
+{
+    PyObject* argTuple;
+    PyObject* kwargs;
+    PyObject* result;
+    int i;
+
+    argTuple = PyTuple_New(argCount);
+    if (argTuple == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < argCount; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(argTuple, i, args[i]);
+    }
+
+    kwargs = NULL;
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        kwargs = PyDict_New();
+        if (kwargs == NULL) {
+            Py_DECREF(argTuple);
+            return NULL;
+        }
+        for (i = 0; i < PyTuple_GET_SIZE(kwnames); i++) {
+            if (PyDict_SetItem(kwargs, PyTuple_GET_ITEM(kwnames, i), args[argCount + i]) < 0) {
+                Py_DECREF(kwargs);
+                Py_DECREF(argTuple);
+                return NULL;
+            }
+        }
+    }
+
+    result = Py_TYPE(type)->tp_call(type, argTuple, kwargs);
+    Py_XDECREF(kwargs);
+    Py_DECREF(argTuple);
+    return result;
+}
+
+/**
+ * The JObj type's tp_vectorcall slot. Called when the type is used to create new instances (constructor).
+ * Passes the argument vector directly to constructor matching and argument conversion, so that no argument
+ * tuple is created. As for JObj_init(), keyword arguments are rejected.
+ */
+PyObject* JObj_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    PyTypeObject* typeObj;
+    PyObject* self;
+    JNIEnv* jenv;
+    int argCount;
+    int result;
+
+    typeObj = (PyTypeObject*) type;
+    argCount = (int) PyVectorcall_NARGS(nargsf);
+
+    // Python subclasses may override __new__ or __init__
+    if (typeObj->tp_new != PyType_GenericNew || typeObj->tp_init != (initproc) JObj_init) {
+        return JObj_CallType(type, args, argCount, kwnames);
+    }
+
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        PyErr_SetString(PyExc_TypeError, "Java constructors do not accept keyword arguments");
+        return NULL;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    self = typeObj->tp_alloc(typeObj, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+
+    if (JPy_PushLocalFrame(jenv) < 0) {
+        result = -1;
+    } else {
+        result = JObj_init0(jenv, (JPy_JObj*) self, argCount, args);
+        JPy_END_LOCAL_FRAME(jenv)
+    }
+
+    if (result < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return self;
+}
+#endif
+
 /**
  * The JObj type's tp_dealloc slot. Called when the reference count reaches zero.
  */
@@ -151,11 +267,13 @@ void JObj_dealloc(JPy_JObj* self)
 
     JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JObj_dealloc: releasing instance of %s, self->objectRef=%p\n", Py_TYPE(self)->tp_name, self->objectRef);
 
-    jenv = JPy_GetJNIEnv();
-    if (jenv != NULL) {
-        if (self->objectRef != NULL) {
-            (*jenv)->DeleteGlobalRef(jenv, self->objectRef);
-        }
+    jenv = JPy_GetReleaseJNIEnv();
+    if (self->objectRef != NULL) {
+        JPy_DeleteGlobalRef(jenv, self->objectRef);
+    }
+
+    if (Py_TYPE(self)->tp_as_buffer == &JBuffer_as_buffer) {
+        JBuffer_ReleaseDirectBuffer((PyObject*) self);
     }
 
     Py_TYPE(self)->tp_free((PyObject*) self);
@@ -200,19 +318,29 @@ int JObj_Equals(JNIEnv* jenv, JPy_JObj* obj1, JPy_JObj* obj2)
     return returnValue;
 }
 
+PyObject* JObj_richcompare0(JNIEnv* jenv, PyObject* obj1, PyObject* obj2, int opid);
+
 /**
  * The JObj type's tp_richcompare slot. Python: obj1 <opid> obj2
  */
 PyObject* JObj_richcompare(PyObject* obj1, PyObject* obj2, int opid)
 {
     JNIEnv* jenv;
+    PyObject* result;
 
     if (!JObj_Check(obj1) || !JObj_Check(obj2)) {
         Py_RETURN_FALSE;
     }
 
     JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL);
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    result = JObj_richcompare0(jenv, obj1, obj2, opid);
+    JPy_END_LOCAL_FRAME(jenv)
+    return result;
+}
 
+PyObject* JObj_richcompare0(JNIEnv* jenv, PyObject* obj1, PyObject* obj2, int opid)
+{
     if (opid == Py_LT) {
         int value = JObj_CompareTo(jenv, (JPy_JObj*) obj1, (JPy_JObj*) obj2);
         if (value == -2) {
@@ -279,13 +407,16 @@ PyObject* JObj_richcompare(PyObject* obj1, PyObject* obj2, int opid)
 long JObj_hash(JPy_JObj* self)
 {
     JNIEnv* jenv;
-    jenv = JPy_GetJNIEnv();
-    if (jenv != NULL) {
-        int returnValue = (*jenv)->CallIntMethod(jenv, self->objectRef, JPy_Object_HashCode_MID);
-        (*jenv)->ExceptionClear(jenv); // we can't deal with exceptions here, so clear any
-        return returnValue;
-    }
-    return -1;
+    int returnValue;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+    JPy_BEGIN_LOCAL_FRAME(jenv, -1)
+
+    returnValue = (*jenv)->CallIntMethod(jenv, self->objectRef, JPy_Object_HashCode_MID);
+    (*jenv)->ExceptionClear(jenv); // we can't deal with exceptions here, so clear any
+
+    JPy_END_LOCAL_FRAME(jenv)
+    return returnValue;
 }
 
 
@@ -312,6 +443,8 @@ PyObject* JObj_str(JPy_JObj* self)
         return Py_BuildValue("");
     }
 
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+
     returnValue = NULL;
     stringRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Object_ToString_MID);
     JPy_ON_JAVA_EXCEPTION_GOTO(error);
@@ -320,171 +453,64 @@ PyObject* JObj_str(JPy_JObj* self)
 error:
     (*jenv)->DeleteLocalRef(jenv, stringRef);
 
+    JPy_END_LOCAL_FRAME(jenv)
     return returnValue;
 }
 
 
+/**
+ * Makes sure that the Java type of the given object is resolved, otherwise we won't find any methods
+ * and fields at all.
+ */
+int JObj_ResolveType(JPy_JObj* self)
+{
+    JPy_JType* selfType;
+    JNIEnv* jenv;
+    int result;
+
+    selfType = (JPy_JType*) Py_TYPE(self);
+    if (selfType->isResolved) {
+        return 0;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+    JPy_BEGIN_LOCAL_FRAME(jenv, -1)
+    result = JType_ResolveType(jenv, selfType);
+    JPy_END_LOCAL_FRAME(jenv)
+    return result;
+}
+
 /**
  * The JObj type's tp_setattro slot.
+ * Field values are set by the JField descriptors found in the type's dictionary, see JField_descr_set().
  */
 int JObj_setattro(JPy_JObj* self, PyObject* name, PyObject* value)
 {
-    PyObject* oldValue;
-
     //printf("JObj_setattro: %s.%s\n", Py_TYPE(self)->tp_name, JPy_AS_UTF8(name));
 
-    oldValue = PyObject_GenericGetAttr((PyObject*) self, name);
-    if (oldValue != NULL && PyObject_TypeCheck(oldValue, &JField_Type)) {
-        JNIEnv* jenv;
-        JPy_JField* field;
-        JPy_JType* type;
-
-        field = (JPy_JField*) oldValue;
-        type = field->type;
-
-        JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
-
-        if (type == JPy_JBoolean) {
-            jboolean item = JPy_AS_JBOOLEAN(value);
-            (*jenv)->SetBooleanField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JChar) {
-            jchar item = JPy_AS_JCHAR(value);
-            (*jenv)->SetCharField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JByte) {
-            jbyte item = JPy_AS_JBYTE(value);
-            (*jenv)->SetByteField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JShort) {
-            jshort item = JPy_AS_JSHORT(value);
-            (*jenv)->SetShortField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JInt) {
-            jint item = JPy_AS_JINT(value);
-            (*jenv)->SetIntField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JLong) {
-            jlong item = JPy_AS_JLONG(value);
-            (*jenv)->SetLongField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JFloat) {
-            jfloat item = JPy_AS_JFLOAT(value);
-            (*jenv)->SetFloatField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JDouble) {
-            jdouble item = JPy_AS_JDOUBLE(value);
-            (*jenv)->SetDoubleField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else {
-            jobject objectRef;
-            if (JPy_AsJObjectWithType(jenv, value, &objectRef, field->type) < 0) {
-                return -1;
-            }
-            (*jenv)->SetObjectField(jenv, self->objectRef, field->fid, objectRef);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        }
-        return 0;
-    } else {
-        return PyObject_GenericSetAttr((PyObject*) self, name, value);
+    if (JObj_ResolveType(self) < 0) {
+        return -1;
     }
+
+    return PyObject_GenericSetAttr((PyObject*) self, name, value);
 }
 
 /**
- * The JObj type's tp_getattro slot.
- * This is important: wrap callable objects of type JOverloadedMethod_Type into python methods so that
- * a method call to an instance x of class X becomes: x.m() --> X.m(x)
+ * The JObj type's tp_getattro slot. Only used until the Java type is resolved, after that
+ * the type uses PyObject_GenericGetAttr, see JType_ResolveType().
+ * Methods are bound to the object by the JOverloadedMethod descriptors found in the type's dictionary,
+ * so that a method call to an instance x of class X becomes: x.m() --> X.m(x). Likewise, field values
+ * are retrieved by the JField descriptors.
  */
 PyObject* JObj_getattro(JPy_JObj* self, PyObject* name)
 {
-    JPy_JType* selfType;
-    PyObject* value;
-
     //printf("JObj_getattro: %s.%s\n", Py_TYPE(self)->tp_name, JPy_AS_UTF8(name));
 
-    // First make sure that the Java type is resolved, otherwise we won't find any methods at all.
-    selfType = (JPy_JType*) Py_TYPE(self);
-    if (!selfType->isResolved) {
-        JNIEnv* jenv;
-        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
-        if (JType_ResolveType(jenv, selfType) < 0) {
-            return NULL;
-        }
-    }
-
-    // todo: implement a special lookup: we need to override __getattro__ of JType (--> JType_getattro) as well so that we know if a method
-    // is called on a class rather than on an instance. Using PyObject_GenericGetAttr will also call  JType_getattro,
-    // but then we loose the information that a method is called on an instance and not on a class.
-    value = PyObject_GenericGetAttr((PyObject*) self, name);
-    if (value == NULL) {
-        //printf("JObj_getattro: not found!\n");
+    if (JObj_ResolveType(self) < 0) {
         return NULL;
     }
-    if (PyObject_TypeCheck(value, &JOverloadedMethod_Type)) {
-        //JPy_JOverloadedMethod* overloadedMethod = (JPy_JOverloadedMethod*) value;
-        //printf("JObj_getattro: wrapping JOverloadedMethod, overloadCount=%d\n", PyList_Size(overloadedMethod->methodList));
-#if defined(JPY_COMPAT_33P)
-        return PyMethod_New(value, (PyObject*) self);
-#elif defined(JPY_COMPAT_27)
-        // todo: py27: 3rd arg must be class of self, check if NULL is ok here
-        return PyMethod_New(value, (PyObject*) self, NULL);
-#else
-#error JPY_VERSION_ERROR
-#endif
-    } else if (PyObject_TypeCheck(value, &JField_Type)) {
-        JNIEnv* jenv;
-        JPy_JField* field;
-        JPy_JType* type;
-
-        field = (JPy_JField*) value;
-        type = field->type;
-
-        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
-
-        if (type == JPy_JBoolean) {
-            jboolean item = (*jenv)->GetBooleanField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JBOOLEAN(item);
-        } else if (type == JPy_JChar) {
-            jchar item = (*jenv)->GetCharField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JCHAR(item);
-        } else if (type == JPy_JByte) {
-            jbyte item = (*jenv)->GetByteField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JBYTE(item);
-        } else if (type == JPy_JShort) {
-            jshort item = (*jenv)->GetShortField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JSHORT(item);
-        } else if (type == JPy_JInt) {
-            jint item = (*jenv)->GetIntField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JINT(item);
-        } else if (type == JPy_JLong) {
-            jlong item = (*jenv)->GetLongField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JLONG(item);
-        } else if (type == JPy_JFloat) {
-            jfloat item = (*jenv)->GetFloatField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JFLOAT(item);
-        } else if (type == JPy_JDouble) {
-            jdouble item = (*jenv)->GetDoubleField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JDOUBLE(item);
-        } else {
-            PyObject* returnValue;
-            jobject item = (*jenv)->GetObjectField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            returnValue = JPy_FromJObjectWithType(jenv, item, field->type);
-            (*jenv)->DeleteLocalRef(jenv, item);
-            return returnValue;
-        }
-    } else {
-        //printf("JObj_getattro: passing through\n");
-    }
-    return value;
+
+    return PyObject_GenericGetAttr((PyObject*) self, name);
 }
 
 /**
@@ -501,18 +527,31 @@ Py_ssize_t JObj_sq_length(JPy_JObj* self)
     return (Py_ssize_t) length;
 }
 
+PyObject* JObj_sq_item0(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t index);
+
 /*
  * The JObj type's sq_item field of the tp_as_sequence slot. Called if 'item = obj[index]' is used.
- * Only used for array types (type->componentType != NULL).
+ * Only used for object array types, primitive array types use the JObj_sq_item_<type> functions.
  */
 PyObject* JObj_sq_item(JPy_JObj* self, Py_ssize_t index)
 {
     JNIEnv* jenv;
+    PyObject* returnValue;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    returnValue = JObj_sq_item0(jenv, self, index);
+    JPy_END_LOCAL_FRAME(jenv)
+    return returnValue;
+}
+
+PyObject* JObj_sq_item0(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t index)
+{
     JPy_JType* type;
     JPy_JType* componentType;
     jsize length;
-
-    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    jobject item;
+    PyObject* returnValue;
 
     //printf("JObj_sq_item: index=%d\n", index);
 
@@ -532,65 +571,23 @@ PyObject* JObj_sq_item(JPy_JObj* self, Py_ssize_t index)
         return NULL;
     }
 
-    if (componentType == JPy_JBoolean) {
-        jboolean item;
-        (*jenv)->GetBooleanArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JBOOLEAN(item);
-    } else if (componentType == JPy_JChar) {
-        jchar item;
-        (*jenv)->GetCharArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JCHAR(item);
-    } else if (componentType == JPy_JByte) {
-        jbyte item;
-        (*jenv)->GetByteArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JBYTE(item);
-    } else if (componentType == JPy_JShort) {
-        jshort item;
-        (*jenv)->GetShortArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JSHORT(item);
-    } else if (componentType == JPy_JInt) {
-        jint item;
-        (*jenv)->GetIntArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JINT(item);
-    } else if (componentType == JPy_JLong) {
-        jlong item;
-        (*jenv)->GetLongArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JLONG(item);
-    } else if (componentType == JPy_JFloat) {
-        jfloat item;
-        (*jenv)->GetFloatArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JFLOAT(item);
-    } else if (componentType == JPy_JDouble) {
-        jdouble item;
-        (*jenv)->GetDoubleArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        return JPy_FROM_JDOUBLE(item);
-    } else {
-        PyObject* returnValue;
-        jobject item = (*jenv)->GetObjectArrayElement(jenv, self->objectRef, (jsize) index);
-        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-        returnValue = JPy_FromJObjectWithType(jenv, item, type->componentType);
-        (*jenv)->DeleteLocalRef(jenv, item);
-        return returnValue;
-    }
+    item = (*jenv)->GetObjectArrayElement(jenv, self->objectRef, (jsize) index);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJObjectWithType(jenv, item, componentType);
+    (*jenv)->DeleteLocalRef(jenv, item);
+    return returnValue;
 }
 
 /*
  * The JObj type's sq_ass_item field of the tp_as_sequence slot. Called if 'obj[index] = item' is used.
- * Only used for array types (type->componentType != NULL).
+ * Only used for object array types, primitive array types use the JObj_sq_ass_item_<type> functions.
  */
 int JObj_sq_ass_item(JPy_JObj* self, Py_ssize_t index, PyObject* pyItem)
 {
     JNIEnv* jenv;
     JPy_JType* type;
     JPy_JType* componentType;
+    jobject item;
 
     JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
 
@@ -607,50 +604,258 @@ int JObj_sq_ass_item(JPy_JObj* self, Py_ssize_t index, PyObject* pyItem)
         return -1;
     }
 
-    // Note: the following item assignments are not value range checked
-    if (componentType == JPy_JBoolean) {
-        jboolean item = JPy_AS_JBOOLEAN(pyItem);
-        (*jenv)->SetBooleanArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JChar) {
-        jchar item = JPy_AS_JCHAR(pyItem);
-        (*jenv)->SetCharArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JByte) {
-        jbyte item = JPy_AS_JBYTE(pyItem);
-        (*jenv)->SetByteArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JShort) {
-        jshort item = JPy_AS_JSHORT(pyItem);
-        (*jenv)->SetShortArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JInt) {
-        jint item = JPy_AS_JINT(pyItem);
-        (*jenv)->SetIntArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JLong) {
-        jlong item = JPy_AS_JLONG(pyItem);
-        (*jenv)->SetLongArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JFloat) {
-        jfloat item = JPy_AS_JFLOAT(pyItem);
-        (*jenv)->SetFloatArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-    } else if (componentType == JPy_JDouble) {
-        jdouble item = JPy_AS_JDOUBLE(pyItem);
-        (*jenv)->SetDoubleArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (JPy_AsJObjectWithType(jenv, pyItem, &item, componentType) < 0) {
+        return -1;
+    }
+    (*jenv)->SetObjectArrayElement(jenv, self->objectRef, (jsize) index, item);
+    if (!JObj_Check(pyItem)) {
+        // A new local reference has been created for the item
+        (*jenv)->DeleteLocalRef(jenv, item);
+    }
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
+}
+
+/**
+ * Resolves the KEY passed to the mp_subscript and mp_ass_subscript functions of array types.
+ * Returns 0 if KEY is an index, which is then stored in START (negative indices are counted from the end),
+ * 1 if KEY is a slice, whose START, STEP and item COUNT are computed, and -1 on errors.
+ */
+static int JObj_GetSubscript(JNIEnv* jenv, JPy_JObj* self, PyObject* key, Py_ssize_t* start, Py_ssize_t* step, Py_ssize_t* count)
+{
+    Py_ssize_t length;
+    Py_ssize_t stop;
+
+    length = (*jenv)->GetArrayLength(jenv, self->objectRef);
+
+    if (PySlice_Check(key)) {
+#if defined(JPY_COMPAT_33P)
+        if (PySlice_GetIndicesEx(key, length, start, &stop, step, count) < 0) {
+#elif defined(JPY_COMPAT_27)
+        if (PySlice_GetIndicesEx((PySliceObject*) key, length, start, &stop, step, count) < 0) {
+#else
+#error JPY_VERSION_ERROR
+#endif
+            return -1;
+        }
+        return 1;
+    }
+
+    if (PyIndex_Check(key)) {
+        Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (index < 0) {
+            index += length;
+        }
+        if (index < 0 || index >= length) {
+            PyErr_SetString(PyExc_IndexError, "Java array index out of bounds");
+            return -1;
+        }
+        *start = index;
+        return 0;
+    }
+
+    PyErr_Format(PyExc_TypeError, "Java array indices must be integers or slices, not %s", Py_TYPE(key)->tp_name);
+    return -1;
+}
+
+/**
+ * Computes the array region [*LO, *LO + *N) covered by a slice given by START, STEP and COUNT > 0.
+ */
+static void JObj_GetSliceRegion(Py_ssize_t start, Py_ssize_t step, Py_ssize_t count, Py_ssize_t* lo, Py_ssize_t* n)
+{
+    if (step > 0) {
+        *lo = start;
+        *n = (count - 1) * step + 1;
     } else {
-        jobject item;
-        if (JPy_AsJObjectWithType(jenv, pyItem, &item, type->componentType) < 0) {
+        *lo = start + (count - 1) * step;
+        *n = (count - 1) * -step + 1;
+    }
+}
+
+/**
+ * Returns a new list of the COUNT object array items given by START and STEP.
+ */
+static PyObject* JObj_GetSlice(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t start, Py_ssize_t step, Py_ssize_t count)
+{
+    JPy_JType* componentType;
+    PyObject* list;
+    PyObject* pyItem;
+    jobject item;
+    Py_ssize_t i;
+
+    componentType = ((JPy_JType*) Py_TYPE(self))->componentType;
+
+    list = PyList_New(count);
+    if (list == NULL) {
+        return NULL;
+    }
+
+    // Java has no region access for object arrays, but we avoid any per-item length checks
+    for (i = 0; i < count; i++) {
+        item = (*jenv)->GetObjectArrayElement(jenv, self->objectRef, (jsize) (start + i * step));
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            Py_DECREF(list);
+            JPy_HandleJavaException(jenv);
+            return NULL;
+        }
+        pyItem = JPy_FromJObjectWithType(jenv, item, componentType);
+        (*jenv)->DeleteLocalRef(jenv, item);
+        if (pyItem == NULL) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, pyItem);
+    }
+
+    return list;
+}
+
+/**
+ * Sets the COUNT object array items given by START and STEP from the items of the sequence PYITEMS.
+ */
+static int JObj_SetSlice(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t start, Py_ssize_t step, Py_ssize_t count, PyObject* pyItems)
+{
+    JPy_JType* componentType;
+    PyObject* fastItems;
+    jobject item;
+    Py_ssize_t i;
+
+    componentType = ((JPy_JType*) Py_TYPE(self))->componentType;
+
+    fastItems = PySequence_Fast(pyItems, "can only assign a sequence to a Java array slice");
+    if (fastItems == NULL) {
+        return -1;
+    }
+    if (PySequence_Fast_GET_SIZE(fastItems) != count) {
+        PyErr_Format(PyExc_ValueError, "cannot resize Java arrays: expected sequence of size %ld, got %ld",
+                     (long) count, (long) PySequence_Fast_GET_SIZE(fastItems));
+        Py_DECREF(fastItems);
+        return -1;
+    }
+
+    for (i = 0; i < count; i++) {
+        PyObject* pyItem = PySequence_Fast_GET_ITEM(fastItems, i);
+        if (JPy_AsJObjectWithType(jenv, pyItem, &item, componentType) < 0) {
+            Py_DECREF(fastItems);
+            return -1;
+        }
+        (*jenv)->SetObjectArrayElement(jenv, self->objectRef, (jsize) (start + i * step), item);
+        if (!JObj_Check(pyItem)) {
+            // A new local reference has been created for the item, wrapped Java objects are global references
+            (*jenv)->DeleteLocalRef(jenv, item);
+        }
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            Py_DECREF(fastItems);
+            JPy_HandleJavaException(jenv);
             return -1;
         }
-        (*jenv)->SetObjectArrayElement(jenv, self->objectRef, (jsize) index, item);
-        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
     }
+
+    Py_DECREF(fastItems);
     return 0;
 }
 
+/**
+ * Defines the mp_subscript and mp_ass_subscript functions of the tp_as_mapping slot for arrays
+ * using the item functions SQ_ITEM/SQ_ASS_ITEM and the slice functions GET_SLICE/SET_SLICE.
+ */
+#define JObj_DEFINE_ARRAY_MAPPING(TYPE_NAME, SQ_ITEM, SQ_ASS_ITEM, GET_SLICE, SET_SLICE) \
+PyObject* JObj_mp_subscript##TYPE_NAME(JPy_JObj* self, PyObject* key) \
+{ \
+    JNIEnv* jenv; \
+    Py_ssize_t start, step, count; \
+    PyObject* returnValue; \
+    int kind; \
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL) \
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL) \
+    kind = JObj_GetSubscript(jenv, self, key, &start, &step, &count); \
+    if (kind < 0) { \
+        returnValue = NULL; \
+    } else if (kind == 0) { \
+        returnValue = SQ_ITEM(self, start); \
+    } else { \
+        returnValue = GET_SLICE(jenv, self, start, step, count); \
+    } \
+    JPy_END_LOCAL_FRAME(jenv) \
+    return returnValue; \
+} \
+int JObj_mp_ass_subscript##TYPE_NAME(JPy_JObj* self, PyObject* key, PyObject* pyItem) \
+{ \
+    JNIEnv* jenv; \
+    Py_ssize_t start, step, count; \
+    int result; \
+    int kind; \
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1) \
+    if (pyItem == NULL) { \
+        PyErr_SetString(PyExc_RuntimeError, "cannot delete items of Java arrays"); \
+        return -1; \
+    } \
+    JPy_BEGIN_LOCAL_FRAME(jenv, -1) \
+    kind = JObj_GetSubscript(jenv, self, key, &start, &step, &count); \
+    if (kind < 0) { \
+        result = -1; \
+    } else if (kind == 0) { \
+        result = SQ_ASS_ITEM(self, start, pyItem); \
+    } else { \
+        result = SET_SLICE(jenv, self, start, step, count, pyItem); \
+    } \
+    JPy_END_LOCAL_FRAME(jenv) \
+    return result; \
+} \
+static PyMappingMethods JObj_as_mapping##TYPE_NAME = { \
+    (lenfunc) JObj_sq_length,                              /* mp_length */ \
+    (binaryfunc) JObj_mp_subscript##TYPE_NAME,             /* mp_subscript */ \
+    (objobjargproc) JObj_mp_ass_subscript##TYPE_NAME,      /* mp_ass_subscript */ \
+};
+
+JObj_DEFINE_ARRAY_MAPPING(, JObj_sq_item, JObj_sq_ass_item, JObj_GetSlice, JObj_SetSlice)
+
+/**
+ * Returns a new list containing all items of a Java array. Python: arr.tolist()
+ */
+PyObject* JObj_tolist(JPy_JObj* self, PyObject* unused)
+{
+    PyObject* slice;
+    PyObject* list;
+
+    slice = PySlice_New(NULL, NULL, NULL);
+    if (slice == NULL) {
+        return NULL;
+    }
+    list = Py_TYPE(self)->tp_as_mapping->mp_subscript((PyObject*) self, slice);
+    Py_DECREF(slice);
+    return list;
+}
+
+/**
+ * The JObj type's tp_iter slot for array types. Iterates over a snapshot of the array items
+ * which is obtained by a single region copy. Python: iter(arr)
+ */
+PyObject* JObj_iter(JPy_JObj* self)
+{
+    PyObject* list;
+    PyObject* iter;
+
+    list = JObj_tolist(self, NULL);
+    if (list == NULL) {
+        return NULL;
+    }
+    iter = PyObject_GetIter(list);
+    Py_DECREF(list);
+    return iter;
+}
+
+/**
+ * The JObj type's tp_methods slot for array types.
+ */
+static PyMethodDef JObj_array_methods[] = {
+    {"tolist", (PyCFunction) JObj_tolist, METH_NOARGS, "Return a new list containing all items of the Java array."},
+    {NULL}  /* Sentinel */
+};
+
 /**
  * The JObj type's tp_as_sequence slot.
  * Implements the <sequence> interface for array types (type->componentType != NULL).
@@ -668,15 +873,165 @@ static PySequenceMethods JObj_as_sequence = {
     NULL,   /* sq_inplace_repeat */
 };
 
+/**
+ * Defines the sq_item and sq_ass_item functions and the tp_as_sequence slot, as well as the slice functions
+ * and the tp_as_mapping slot for arrays of the primitive type NAME. Slices are accessed by single region copies.
+ * Note: the item assignments are not value range checked.
+ */
+#define JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(NAME, TYPE_NAME, JTYPE, FROM_JTYPE, AS_JTYPE) \
+PyObject* JObj_sq_item_##TYPE_NAME(JPy_JObj* self, Py_ssize_t index) \
+{ \
+    JNIEnv* jenv; \
+    JTYPE item; \
+    PyObject* returnValue; \
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL) \
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL) \
+    returnValue = NULL; \
+    if (index < 0 || index >= (*jenv)->GetArrayLength(jenv, self->objectRef)) { \
+        PyErr_SetString(PyExc_IndexError, "Java array index out of bounds"); \
+    } else { \
+        (*jenv)->Get##NAME##ArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item); \
+        if ((*jenv)->ExceptionCheck(jenv)) { \
+            JPy_HandleJavaException(jenv); \
+        } else { \
+            returnValue = FROM_JTYPE(item); \
+        } \
+    } \
+    JPy_END_LOCAL_FRAME(jenv) \
+    return returnValue; \
+} \
+int JObj_sq_ass_item_##TYPE_NAME(JPy_JObj* self, Py_ssize_t index, PyObject* pyItem) \
+{ \
+    JNIEnv* jenv; \
+    JTYPE item; \
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1) \
+    if (pyItem == NULL) { \
+        PyErr_SetString(PyExc_RuntimeError, "cannot delete items of Java arrays"); \
+        return -1; \
+    } \
+    item = AS_JTYPE(pyItem); \
+    (*jenv)->Set##NAME##ArrayRegion(jenv, self->objectRef, (jsize) index, 1, &item); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1); \
+    return 0; \
+} \
+static PySequenceMethods JObj_as_sequence_##TYPE_NAME = { \
+    (lenfunc) JObj_sq_length,                    /* sq_length */ \
+    NULL,                                        /* sq_concat */ \
+    NULL,                                        /* sq_repeat */ \
+    (ssizeargfunc) JObj_sq_item_##TYPE_NAME,         /* sq_item */ \
+    NULL,                                        /* was_sq_slice */ \
+    (ssizeobjargproc) JObj_sq_ass_item_##TYPE_NAME,  /* sq_ass_item */ \
+    NULL,                                        /* was_sq_ass_slice */ \
+    NULL,                                        /* sq_contains */ \
+    NULL,                                        /* sq_inplace_concat */ \
+    NULL,                                        /* sq_inplace_repeat */ \
+}; \
+static PyObject* JObj_GetSlice_##TYPE_NAME(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t start, Py_ssize_t step, Py_ssize_t count) \
+{ \
+    JTYPE* items; \
+    PyObject* list; \
+    PyObject* pyItem; \
+    Py_ssize_t lo, n, i; \
+    list = PyList_New(count); \
+    if (list == NULL || count == 0) { \
+        return list; \
+    } \
+    JObj_GetSliceRegion(start, step, count, &lo, &n); \
+    items = PyMem_New(JTYPE, n); \
+    if (items == NULL) { \
+        Py_DECREF(list); \
+        return PyErr_NoMemory(); \
+    } \
+    (*jenv)->Get##NAME##ArrayRegion(jenv, self->objectRef, (jsize) lo, (jsize) n, items); \
+    if ((*jenv)->ExceptionCheck(jenv)) { \
+        PyMem_Del(items); \
+        Py_DECREF(list); \
+        JPy_HandleJavaException(jenv); \
+        return NULL; \
+    } \
+    for (i = 0; i < count; i++) { \
+        pyItem = FROM_JTYPE(items[start - lo + i * step]); \
+        if (pyItem == NULL) { \
+            PyMem_Del(items); \
+            Py_DECREF(list); \
+            return NULL; \
+        } \
+        PyList_SET_ITEM(list, i, pyItem); \
+    } \
+    PyMem_Del(items); \
+    return list; \
+} \
+static int JObj_SetSlice_##TYPE_NAME(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t start, Py_ssize_t step, Py_ssize_t count, PyObject* pyItems) \
+{ \
+    JTYPE* items; \
+    PyObject* fastItems; \
+    PyObject* pyItem; \
+    Py_ssize_t lo, n, i; \
+    fastItems = PySequence_Fast(pyItems, "can only assign a sequence to a Java array slice"); \
+    if (fastItems == NULL) { \
+        return -1; \
+    } \
+    if (PySequence_Fast_GET_SIZE(fastItems) != count) { \
+        PyErr_Format(PyExc_ValueError, "cannot resize Java arrays: expected sequence of size %ld, got %ld", \
+                     (long) count, (long) PySequence_Fast_GET_SIZE(fastItems)); \
+        Py_DECREF(fastItems); \
+        return -1; \
+    } \
+    if (count == 0) { \
+        Py_DECREF(fastItems); \
+        return 0; \
+    } \
+    JObj_GetSliceRegion(start, step, count, &lo, &n); \
+    items = PyMem_New(JTYPE, n); \
+    if (items == NULL) { \
+        Py_DECREF(fastItems); \
+        PyErr_NoMemory(); \
+        return -1; \
+    } \
+    if (n != count) { \
+        /* Extended slice: preserve the items in between */ \
+        (*jenv)->Get##NAME##ArrayRegion(jenv, self->objectRef, (jsize) lo, (jsize) n, items); \
+        JPy_ON_JAVA_EXCEPTION_GOTO(error); \
+    } \
+    for (i = 0; i < count; i++) { \
+        pyItem = PySequence_Fast_GET_ITEM(fastItems, i); \
+        items[start - lo + i * step] = AS_JTYPE(pyItem); \
+    } \
+    if (PyErr_Occurred()) { \
+        goto error; \
+    } \
+    (*jenv)->Set##NAME##ArrayRegion(jenv, self->objectRef, (jsize) lo, (jsize) n, items); \
+    JPy_ON_JAVA_EXCEPTION_GOTO(error); \
+    PyMem_Del(items); \
+    Py_DECREF(fastItems); \
+    return 0; \
+error: \
+    PyMem_Del(items); \
+    Py_DECREF(fastItems); \
+    return -1; \
+} \
+JObj_DEFINE_ARRAY_MAPPING(_##TYPE_NAME, JObj_sq_item_##TYPE_NAME, JObj_sq_ass_item_##TYPE_NAME, JObj_GetSlice_##TYPE_NAME, JObj_SetSlice_##TYPE_NAME)
+
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Boolean, boolean, jboolean, JPy_FROM_JBOOLEAN, JPy_AS_JBOOLEAN)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Char, char, jchar, JPy_FROM_JCHAR, JPy_AS_JCHAR)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Byte, byte, jbyte, JPy_FROM_JBYTE, JPy_AS_JBYTE)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Short, short, jshort, JPy_FROM_JSHORT, JPy_AS_JSHORT)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Int, int, jint, JPy_FROM_JINT, JPy_AS_JINT)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Long, long, jlong, JPy_FROM_JLONG, JPy_AS_JLONG)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Float, float, jfloat, JPy_FROM_JFLOAT, JPy_AS_JFLOAT)
+JObj_DEFINE_PRIMITIVE_ARRAY_SEQUENCE(Double, double, jdouble, JPy_FROM_JDOUBLE, JPy_AS_JDOUBLE)
+
 
 int JType_InitSlots(JPy_JType* type)
 {
     PyTypeObject* typeObj;
     jboolean isArray;
     jboolean isPrimitiveArray;
+    jboolean isBuffer;
 
     isArray = type->componentType != NULL;
     isPrimitiveArray = isArray && type->componentType->isPrimitive;
+    isBuffer = !isArray && JBuffer_IsBufferType(type);
 
     typeObj = (PyTypeObject*) type;
 
@@ -700,12 +1055,13 @@ int JType_InitSlots(JPy_JType* type)
     //typeObj->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HEAPTYPE;
 
     #if defined(JPY_COMPAT_27)
-    if (isPrimitiveArray) {
+    if (isPrimitiveArray || isBuffer) {
         typeObj->tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
     }
     #endif
 
-    typeObj->tp_getattro = (getattrofunc) JObj_getattro;
+    // Resolved types use the generic lookup, see JType_ResolveType()
+    typeObj->tp_getattro = type->isResolved ? PyObject_GenericGetAttr : (getattrofunc) JObj_getattro;
     typeObj->tp_setattro = (setattrofunc) JObj_setattro;
 
     // Note: we may later want to add  <sequence> protocol to 'java.lang.String' and 'java.util.List' types.
@@ -719,34 +1075,61 @@ int JType_InitSlots(JPy_JType* type)
     // If this type is an array type, add support for the <sequence> protocol
     if (isArray) {
         typeObj->tp_as_sequence = &JObj_as_sequence;
+        typeObj->tp_as_mapping = &JObj_as_mapping;
+        typeObj->tp_iter = (getiterfunc) JObj_iter;
+        typeObj->tp_methods = JObj_array_methods;
     }
 
     if (isPrimitiveArray) {
         const char* componentTypeName = type->componentType->javaName;
         if (strcmp(componentTypeName, "boolean") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_boolean;
+            typeObj->tp_as_mapping = &JObj_as_mapping_boolean;
             typeObj->tp_as_buffer = &JArray_as_buffer_boolean;
         } else if (strcmp(componentTypeName, "char") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_char;
+            typeObj->tp_as_mapping = &JObj_as_mapping_char;
             typeObj->tp_as_buffer = &JArray_as_buffer_char;
         } else if (strcmp(componentTypeName, "byte") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_byte;
+            typeObj->tp_as_mapping = &JObj_as_mapping_byte;
             typeObj->tp_as_buffer = &JArray_as_buffer_byte;
         } else if (strcmp(componentTypeName, "short") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_short;
+            typeObj->tp_as_mapping = &JObj_as_mapping_short;
             typeObj->tp_as_buffer = &JArray_as_buffer_short;
         } else if (strcmp(componentTypeName, "int") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_int;
+            typeObj->tp_as_mapping = &JObj_as_mapping_int;
             typeObj->tp_as_buffer = &JArray_as_buffer_int;
         } else if (strcmp(componentTypeName, "long") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_long;
+            typeObj->tp_as_mapping = &JObj_as_mapping_long;
             typeObj->tp_as_buffer = &JArray_as_buffer_long;
         } else if (strcmp(componentTypeName, "float") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_float;
+            typeObj->tp_as_mapping = &JObj_as_mapping_float;
             typeObj->tp_as_buffer = &JArray_as_buffer_float;
         } else if (strcmp(componentTypeName, "double") == 0) {
+            typeObj->tp_as_sequence = &JObj_as_sequence_double;
+            typeObj->tp_as_mapping = &JObj_as_mapping_double;
             typeObj->tp_as_buffer = &JArray_as_buffer_double;
         }
     }
 
+    // If this type is a java.nio.Buffer, add support for the <buffer> protocol, which is only available for direct buffers
+    if (isBuffer) {
+        typeObj->tp_as_buffer = &JBuffer_as_buffer;
+    }
+
     //printf("JType_InitSlots: typeObj->tp_as_buffer=%p\n", typeObj->tp_as_buffer);
 
     typeObj->tp_alloc = PyType_GenericAlloc;
     typeObj->tp_new = PyType_GenericNew;
     typeObj->tp_init = (initproc) JObj_init;
+#if defined(JPY_VECTORCALL)
+    typeObj->tp_vectorcall = JObj_vectorcall;
+#endif
     typeObj->tp_richcompare = (richcmpfunc) JObj_richcompare;
     typeObj->tp_hash = (hashfunc) JObj_hash;
     typeObj->tp_repr = (reprfunc) JObj_repr;
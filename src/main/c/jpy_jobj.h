@@ -42,6 +42,9 @@ JPy_JObj* JObj_FromType(JNIEnv* jenv, JPy_JType* type, jobject objectRef);
 
 int JObj_InitTypeSlots(PyTypeObject* type, const char* typeName, PyTypeObject* superType);
 
+int JObj_ResolveType(JPy_JObj* self);
+PyObject* JObj_getattro(JPy_JObj* self, PyObject* name);
+
 
 #ifdef __cplusplus
 }  /* extern "C" */
@@ -32,8 +32,13 @@ int JType_ProcessClassConstructors(JNIEnv* jenv, JPy_JType* type);
 int JType_ProcessClassFields(JNIEnv* jenv, JPy_JType* type);
 int JType_ProcessClassMethods(JNIEnv* jenv, JPy_JType* type);
 int JType_AddMethod(JPy_JType* type, JPy_JMethod* method);
+int JType_AddPendingMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, jobject memberRef, PyObject* signature, jmethodID mid, jboolean isStatic, jboolean isConstructor);
+int JType_ProcessClassMetadata(JNIEnv* jenv, JPy_JType* type, PyObject* typeMetadata);
+int JType_GetDeclaredMemberCount(JNIEnv* jenv, JPy_JType* type);
+int JType_ProcessMethod0(JPy_JType* type, PyObject* methodKey, const char* methodName, int paramCount, JPy_ParamDescriptor* paramDescriptors, JPy_ReturnDescriptor* returnDescriptor, jboolean isStatic, jmethodID mid);
 JPy_ReturnDescriptor* JType_CreateReturnDescriptor(JNIEnv* jenv, jclass returnType);
 JPy_ParamDescriptor* JType_CreateParamDescriptors(JNIEnv* jenv, int paramCount, jarray paramTypes);
+void JType_InitParamDescriptor(JPy_ParamDescriptor* paramDescriptor, JPy_JType* type);
 void JType_InitParamDescriptorFunctions(JPy_ParamDescriptor* paramDescriptor);
 void JType_InitMethodParamDescriptorFunctions(JPy_JType* type, JPy_JMethod* method);
 int JType_ProcessField(JNIEnv* jenv, JPy_JType* declaringType, PyObject* fieldKey, const char* fieldName, jclass fieldClassRef, jboolean isStatic, jboolean isFinal, jfieldID fid);
@@ -112,6 +117,131 @@ JPy_JType* JType_GetTypeForName(JNIEnv* jenv, const char* typeName, jboolean res
     return JType_GetType(jenv, classRef, resolve);
 }
 
+/**
+ * Number of buckets of the type cache. Must be a power of two.
+ */
+#define JPy_TYPE_CACHE_SIZE 1024
+/**
+ * Number of most recently looked up types, which are found without computing the class' hash code.
+ */
+#define JPy_RECENT_TYPE_COUNT 8
+
+/**
+ * An entry of the type cache, which maps Java classes to their (finalized) types in 'jpy.types'.
+ * Entries are looked up by the identity hash code of the Java class. The cache holds references to its types,
+ * so that they stay valid even if they are removed from 'jpy.types'.
+ */
+typedef struct JPy_TypeCacheEntry
+{
+    // The Java class' identity hash code.
+    jint hash;
+    // The type (new reference).
+    JPy_JType* type;
+    // The next entry in the same bucket.
+    struct JPy_TypeCacheEntry* next;
+}
+JPy_TypeCacheEntry;
+
+static JPy_TypeCacheEntry* JType_TypeCache[JPy_TYPE_CACHE_SIZE];
+// The most recently looked up types (new references), NULL for unused entries.
+static JPy_JType* JType_RecentTypes[JPy_RECENT_TYPE_COUNT];
+// Index of the recent type to be replaced next.
+static int JType_RecentTypeNext = 0;
+
+/**
+ * Looks up the type for the given Java class among the most recently looked up types. Unlike for the type cache,
+ * no call into Java is needed to compute the class' hash code, only IsSameObject() is used.
+ * Returns a borrowed reference or NULL, if the type is not found.
+ */
+static JPy_JType* JType_GetRecentType(JNIEnv* jenv, jclass classRef)
+{
+    JPy_JType* type;
+    int i;
+
+    for (i = 0; i < JPy_RECENT_TYPE_COUNT; i++) {
+        type = JType_RecentTypes[i];
+        if (type == NULL) {
+            break;
+        }
+        if ((*jenv)->IsSameObject(jenv, type->classRef, classRef)) {
+            return type;
+        }
+    }
+    return NULL;
+}
+
+static void JType_AddRecentType(JPy_JType* type)
+{
+    Py_INCREF(type);
+    Py_XDECREF(JType_RecentTypes[JType_RecentTypeNext]);
+    JType_RecentTypes[JType_RecentTypeNext] = type;
+    JType_RecentTypeNext = (JType_RecentTypeNext + 1) % JPy_RECENT_TYPE_COUNT;
+}
+
+/**
+ * Looks up the type for the given Java class in the type cache.
+ * Returns a borrowed reference or NULL, if the type is not cached.
+ */
+static JPy_JType* JType_GetCachedType(JNIEnv* jenv, jclass classRef, jint hash)
+{
+    JPy_TypeCacheEntry* entry;
+
+    entry = JType_TypeCache[hash & (JPy_TYPE_CACHE_SIZE - 1)];
+    while (entry != NULL) {
+        if (entry->hash == hash && (*jenv)->IsSameObject(jenv, entry->type->classRef, classRef)) {
+            return entry->type;
+        }
+        entry = entry->next;
+    }
+    return NULL;
+}
+
+static void JType_AddCachedType(JPy_JType* type, jint hash)
+{
+    JPy_TypeCacheEntry* entry;
+    int index;
+
+    entry = PyMem_New(JPy_TypeCacheEntry, 1);
+    if (entry == NULL) {
+        // Not an error, the type will be looked up in JPy_Types next time
+        return;
+    }
+
+    index = hash & (JPy_TYPE_CACHE_SIZE - 1);
+    entry->hash = hash;
+    entry->type = type;
+    Py_INCREF(type);
+    entry->next = JType_TypeCache[index];
+    JType_TypeCache[index] = entry;
+}
+
+/**
+ * Removes all entries from the type cache. Must be called when JPy_Types is cleared or the Java VM is destroyed.
+ */
+void JType_ClearTypeCache(void)
+{
+    JPy_TypeCacheEntry* entry;
+    JPy_TypeCacheEntry* next;
+    int i;
+
+    for (i = 0; i < JPy_TYPE_CACHE_SIZE; i++) {
+        entry = JType_TypeCache[i];
+        JType_TypeCache[i] = NULL;
+        while (entry != NULL) {
+            next = entry->next;
+            Py_DECREF(entry->type);
+            PyMem_Del(entry);
+            entry = next;
+        }
+    }
+
+    for (i = 0; i < JPy_RECENT_TYPE_COUNT; i++) {
+        Py_XDECREF(JType_RecentTypes[i]);
+        JType_RecentTypes[i] = NULL;
+    }
+    JType_RecentTypeNext = 0;
+}
+
 /**
  * Returns a new reference.
  */
@@ -121,12 +251,34 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
     PyObject* typeValue;
     JPy_JType* type;
     jboolean found;
+    jint hash;
 
     if (JPy_Types == NULL) {
         PyErr_SetString(PyExc_RuntimeError, "jpy internal error: module 'jpy' not initialized");
         return NULL;
     }
 
+    hash = 0;
+    type = JType_GetRecentType(jenv, classRef);
+    if (type == NULL && JPy_Object_HashCode_MID != NULL) {
+        // java.lang.Class doesn't override Object.hashCode(), so this is the class' identity hash code
+        hash = (*jenv)->CallIntMethod(jenv, classRef, JPy_Object_HashCode_MID);
+        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+        type = JType_GetCachedType(jenv, classRef, hash);
+        if (type != NULL) {
+            JType_AddRecentType(type);
+        }
+    }
+
+    if (type != NULL) {
+        if (!type->isResolved && resolve) {
+            if (JType_ResolveType(jenv, type) < 0) {
+                return NULL;
+            }
+        }
+        return type;
+    }
+
     typeKey = JPy_FromTypeName(jenv, classRef);
     if (typeKey == NULL) {
         return NULL;
@@ -202,6 +354,12 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
 
     JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_GetType: javaName=\"%s\", found=%d, resolve=%d, resolved=%d, type=%p\n", type->javaName, found, resolve, type->isResolved, type);
 
+    // Only cache finalized types, types in progress may still be removed from JPy_Types
+    if (JPy_Object_HashCode_MID != NULL && Py_TYPE(type) != &JType_Type) {
+        JType_AddCachedType(type, hash);
+        JType_AddRecentType(type);
+    }
+
     if (!type->isResolved && resolve) {
         if (JType_ResolveType(jenv, type) < 0) {
             return NULL;
@@ -232,6 +390,7 @@ JPy_JType* JType_New(JNIEnv* jenv, jclass classRef, jboolean resolve)
     type->classRef = NULL;
     type->isResolved = JNI_FALSE;
     type->isResolving = JNI_FALSE;
+    type->methodGeneration = 0;
 
     type->javaName = JPy_GetTypeName(jenv, classRef);
     if (type->javaName == NULL) {
@@ -432,6 +591,226 @@ int JType_CreateJavaPyObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, job
     return JType_CreateJavaObject(jenv, type, pyArg, type->classRef, JPy_PyObject_Init_MID, value, objectRef);
 }
 
+/**
+ * Converts the items of a contiguous Python buffer given by BUF, using the C item type SRC_TYPE,
+ * into the Java array items ITEMS of type JTYPE. CONVERT is one of the JType_CAST_BUFFER_ITEM or
+ * JType_TEST_BUFFER_ITEM macros. The loop is kept free of calls so that the compiler can vectorize it.
+ */
+#define JType_CONVERT_BUFFER_ITEMS(SRC_TYPE, JTYPE, CONVERT) \
+    { \
+        const SRC_TYPE* src = (const SRC_TYPE*) buf; \
+        Py_ssize_t i; \
+        for (i = 0; i < itemCount; i++) { \
+            items[i] = CONVERT(JTYPE, src[i]); \
+        } \
+    }
+
+#define JType_CAST_BUFFER_ITEM(JTYPE, X) ((JTYPE) (X))
+#define JType_TEST_BUFFER_ITEM(JTYPE, X) ((JTYPE) ((X) != 0))
+
+/**
+ * Defines the function JType_Create<NAME>ArrayFromBuffer() which creates a new Java primitive array from the items
+ * of a contiguous Python buffer. If isExact is true, the buffer items have the same representation as
+ * the Java array items and are copied in bulk, otherwise each item is converted.
+ */
+#define JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(NAME, JTYPE, CONVERT) \
+static int JType_Create##NAME##ArrayFromBuffer(JNIEnv* jenv, Py_buffer* view, char format, jboolean isExact, jarray* arrayRef) \
+{ \
+    Py_ssize_t itemCount = view->len / view->itemsize; \
+    const void* buf = view->buf; \
+    JTYPE* items; \
+    *arrayRef = (*jenv)->New##NAME##Array(jenv, (jsize) itemCount); \
+    if (*arrayRef == NULL || (*jenv)->ExceptionCheck(jenv)) { \
+        JPy_HandleJavaException(jenv); \
+        return -1; \
+    } \
+    if (itemCount == 0) { \
+        return 0; \
+    } \
+    if (isExact) { \
+        (*jenv)->Set##NAME##ArrayRegion(jenv, *arrayRef, 0, (jsize) itemCount, (const JTYPE*) buf); \
+        if ((*jenv)->ExceptionCheck(jenv)) { \
+            (*jenv)->DeleteLocalRef(jenv, *arrayRef); \
+            JPy_HandleJavaException(jenv); \
+            return -1; \
+        } \
+        return 0; \
+    } \
+    items = (*jenv)->GetPrimitiveArrayCritical(jenv, *arrayRef, NULL); \
+    if (items == NULL) { \
+        (*jenv)->DeleteLocalRef(jenv, *arrayRef); \
+        PyErr_NoMemory(); \
+        return -1; \
+    } \
+    switch (format) { \
+        case 'b': JType_CONVERT_BUFFER_ITEMS(signed char, JTYPE, CONVERT); break; \
+        case '?': \
+        case 'B': JType_CONVERT_BUFFER_ITEMS(unsigned char, JTYPE, CONVERT); break; \
+        case 'h': JType_CONVERT_BUFFER_ITEMS(short, JTYPE, CONVERT); break; \
+        case 'H': JType_CONVERT_BUFFER_ITEMS(unsigned short, JTYPE, CONVERT); break; \
+        case 'i': JType_CONVERT_BUFFER_ITEMS(int, JTYPE, CONVERT); break; \
+        case 'I': JType_CONVERT_BUFFER_ITEMS(unsigned int, JTYPE, CONVERT); break; \
+        case 'l': JType_CONVERT_BUFFER_ITEMS(long, JTYPE, CONVERT); break; \
+        case 'L': JType_CONVERT_BUFFER_ITEMS(unsigned long, JTYPE, CONVERT); break; \
+        case 'q': JType_CONVERT_BUFFER_ITEMS(long long, JTYPE, CONVERT); break; \
+        case 'Q': JType_CONVERT_BUFFER_ITEMS(unsigned long long, JTYPE, CONVERT); break; \
+        case 'f': JType_CONVERT_BUFFER_ITEMS(float, JTYPE, CONVERT); break; \
+        case 'd': JType_CONVERT_BUFFER_ITEMS(double, JTYPE, CONVERT); break; \
+    } \
+    (*jenv)->ReleasePrimitiveArrayCritical(jenv, *arrayRef, items, 0); \
+    return 0; \
+}
+
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Boolean, jboolean, JType_TEST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Char, jchar, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Byte, jbyte, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Short, jshort, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Int, jint, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Long, jlong, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Float, jfloat, JType_CAST_BUFFER_ITEM)
+JType_DEFINE_CREATE_ARRAY_FROM_BUFFER(Double, jdouble, JType_CAST_BUFFER_ITEM)
+
+/**
+ * Returns the size of a native buffer item given by its struct module format character,
+ * or 0 if the format is not supported for conversion into Java primitive arrays.
+ */
+static Py_ssize_t JType_GetBufferFormatItemSize(char format)
+{
+    switch (format) {
+        case 'b':
+        case 'B':
+        case '?': return 1;
+        case 'h':
+        case 'H': return sizeof(short);
+        case 'i':
+        case 'I': return sizeof(int);
+        case 'l':
+        case 'L': return sizeof(long);
+        case 'q':
+        case 'Q': return sizeof(long long);
+        case 'f': return sizeof(float);
+        case 'd': return sizeof(double);
+        default:  return 0;
+    }
+}
+
+/**
+ * Returns the struct module format character of the items of a one-dimensional Python buffer,
+ * or 0 if the items are not of a native numeric format supported for conversion into Java primitive values.
+ * Only native item formats, such as "i" or "@d", are supported.
+ */
+char JType_GetBufferFormatChar(const Py_buffer* view)
+{
+    const char* format;
+
+    format = view->format != NULL ? view->format : "B";
+    if (*format == '@') {
+        format++;
+    }
+
+    if (view->ndim != 1
+        || format[0] == 0 || format[1] != 0
+        || view->itemsize != JType_GetBufferFormatItemSize(format[0])) {
+        return 0;
+    }
+
+    return format[0];
+}
+
+/**
+ * Creates a new Java primitive array from a one-dimensional, contiguous Python buffer such as
+ * a bytes, array.array or numpy array object.
+ *
+ * Returns 0 on success, -1 on error, and 1 if the buffer's item format is not compatible with the array's
+ * component type, in which case the caller must convert the Python argument item-wise.
+ */
+static int JType_CreateJavaArrayFromBuffer(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyArg, jobject* objectRef)
+{
+    Py_buffer view;
+    char formatChar;
+    jboolean isFloatFormat;
+    jboolean isFloatType;
+    jboolean isExact;
+    Py_ssize_t itemSize;
+    jarray arrayRef;
+    int result;
+
+    if (PyObject_GetBuffer(pyArg, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        PyErr_Clear();
+        return 1;
+    }
+
+    formatChar = JType_GetBufferFormatChar(&view);
+    if (formatChar == 0 || view.len / view.itemsize > 0x7fffffff) {
+        PyBuffer_Release(&view);
+        return 1;
+    }
+
+    if (componentType == JPy_JBoolean) {
+        itemSize = sizeof(jboolean);
+    } else if (componentType == JPy_JChar) {
+        itemSize = sizeof(jchar);
+    } else if (componentType == JPy_JByte) {
+        itemSize = sizeof(jbyte);
+    } else if (componentType == JPy_JShort) {
+        itemSize = sizeof(jshort);
+    } else if (componentType == JPy_JInt) {
+        itemSize = sizeof(jint);
+    } else if (componentType == JPy_JLong) {
+        itemSize = sizeof(jlong);
+    } else if (componentType == JPy_JFloat) {
+        itemSize = sizeof(jfloat);
+    } else if (componentType == JPy_JDouble) {
+        itemSize = sizeof(jdouble);
+    } else {
+        PyBuffer_Release(&view);
+        return 1;
+    }
+
+    isFloatFormat = formatChar == 'f' || formatChar == 'd';
+    isFloatType = componentType == JPy_JFloat || componentType == JPy_JDouble;
+    if (isFloatFormat && !isFloatType) {
+        // Let item-wise conversion report the error, floats are not implicitly converted into integers
+        PyBuffer_Release(&view);
+        return 1;
+    }
+
+    if (componentType == JPy_JBoolean) {
+        isExact = formatChar == '?';
+    } else {
+        isExact = isFloatFormat == isFloatType && view.itemsize == itemSize;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC|JPy_DIAG_F_MEM, "JType_CreateJavaArrayFromBuffer: componentType=%s, format='%c', len=%ld, isExact=%d\n", componentType->javaName, formatChar, view.len, isExact);
+
+    if (componentType == JPy_JBoolean) {
+        result = JType_CreateBooleanArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JChar) {
+        result = JType_CreateCharArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JByte) {
+        result = JType_CreateByteArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JShort) {
+        result = JType_CreateShortArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JInt) {
+        result = JType_CreateIntArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JLong) {
+        result = JType_CreateLongArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else if (componentType == JPy_JFloat) {
+        result = JType_CreateFloatArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    } else {
+        result = JType_CreateDoubleArrayFromBuffer(jenv, &view, formatChar, isExact, &arrayRef);
+    }
+
+    PyBuffer_Release(&view);
+
+    if (result < 0) {
+        return -1;
+    }
+
+    *objectRef = arrayRef;
+    return 0;
+}
+
 int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyArg, jobject* objectRef)
 {
     jint itemCount;
@@ -439,6 +818,13 @@ int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyAr
     jint index;
     PyObject* pyItem;
 
+    if (componentType->isPrimitive && pyArg != Py_None && PyObject_CheckBuffer(pyArg)) {
+        int result = JType_CreateJavaArrayFromBuffer(jenv, componentType, pyArg, objectRef);
+        if (result <= 0) {
+            return result;
+        }
+    }
+
     if (pyArg == Py_None) {
         itemCount = 0;
     } else if (PySequence_Check(pyArg)) {
@@ -790,13 +1176,18 @@ int JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyA
 
 
 /**
- * Fill the type __dict__ with our Java class constructors and methods.
+ * Fill the type __dict__ with our Java class constructors, methods and fields.
  * Constructors will be available using the key named __jinit__.
- * Methods will be available using their method name.
+ * Methods and fields will be available using their name.
+ * Only the names of the members are collected here, their parameter and return types are processed on first use,
+ * see JOverloadedMethod_ResolvePendingMethods() and JField_ResolveType().
  */
 int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
 {
     PyTypeObject* typeObj;
+    PyObject* metadata;
+    PyObject* typeMetadata;
+    int result;
 
     if (type->isResolved || type->isResolving) {
         return 0;
@@ -815,30 +1206,120 @@ int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
         }
     }
 
-    //printf("JType_ResolveType 1\n");
-    if (JType_ProcessClassConstructors(jenv, type) < 0) {
-        type->isResolving = JNI_FALSE;
-        return -1;
+    // Use the members given by the type metadata, if any, see jpy.preload() and jpy.set_type_metadata()
+    metadata = JPy_PreloadMetadata;
+    typeMetadata = metadata != NULL ? PyDict_GetItemString(metadata, type->javaName) : NULL;
+    if (typeMetadata == NULL) {
+        metadata = JPy_TypeMetadata;
+        typeMetadata = metadata != NULL ? PyDict_GetItemString(metadata, type->javaName) : NULL;
     }
-
-    //printf("JType_ResolveType 2\n");
-    if (JType_ProcessClassMethods(jenv, type) < 0) {
+    result = typeMetadata != NULL ? JType_ProcessClassMetadata(jenv, type, typeMetadata) : 1;
+    if (result < 0) {
         type->isResolving = JNI_FALSE;
         return -1;
     }
+    if (result > 0 && typeMetadata != NULL) {
+        // The metadata doesn't match the class, don't use it anymore
+        if (PyDict_DelItemString(metadata, type->javaName) < 0) {
+            PyErr_Clear();
+        }
+    }
 
-    //printf("JType_ResolveType 3\n");
-    if (JType_ProcessClassFields(jenv, type) < 0) {
-        type->isResolving = JNI_FALSE;
-        return -1;
+    if (result > 0) {
+        //printf("JType_ResolveType 1\n");
+        if (JType_ProcessClassConstructors(jenv, type) < 0) {
+            type->isResolving = JNI_FALSE;
+            return -1;
+        }
+
+        //printf("JType_ResolveType 2\n");
+        if (JType_ProcessClassMethods(jenv, type) < 0) {
+            type->isResolving = JNI_FALSE;
+            return -1;
+        }
+
+        //printf("JType_ResolveType 3\n");
+        if (JType_ProcessClassFields(jenv, type) < 0) {
+            type->isResolving = JNI_FALSE;
+            return -1;
+        }
     }
 
     //printf("JType_ResolveType 4\n");
     type->isResolving = JNI_FALSE;
     type->isResolved = JNI_TRUE;
+
+    // Resolved types can use the generic attribute lookup, which also enables the interpreter's method call
+    // optimizations that avoid creating bound method objects
+    if (typeObj->tp_getattro == (getattrofunc) JObj_getattro) {
+        typeObj->tp_getattro = PyObject_GenericGetAttr;
+        PyType_Modified(typeObj);
+    }
     return 0;
 }
 
+/**
+ * Resolves the given type's element type, i.e. the innermost component type of an array type.
+ */
+int JType_ResolveElementType(JNIEnv* jenv, JPy_JType* type)
+{
+    while (type->componentType != NULL) {
+        type = type->componentType;
+    }
+    return type->isPrimitive ? 0 : JType_ResolveType(jenv, type);
+}
+
+/**
+ * Processes the pending methods and resolves the field types of the given type, which are otherwise processed on
+ * first use of a member. If resolveMemberTypes is set, the parameter, return and field types are resolved too.
+ * See jpy.preload().
+ */
+int JType_ResolveMembers(JNIEnv* jenv, JPy_JType* type, jboolean resolveMemberTypes)
+{
+    PyObject* members;
+    PyObject* member;
+    JPy_JOverloadedMethod* overloadedMethod;
+    JPy_JMethod* method;
+    Py_ssize_t i;
+    int j, k;
+    int result;
+
+    if (JType_ResolveType(jenv, type) < 0) {
+        return -1;
+    }
+
+    members = PyDict_Values(type->typeObj.tp_dict);
+    if (members == NULL) {
+        return -1;
+    }
+
+    result = 0;
+    for (i = 0; i < PyList_GET_SIZE(members) && result == 0; i++) {
+        member = PyList_GET_ITEM(members, i);
+        if (PyObject_TypeCheck(member, &JOverloadedMethod_Type)) {
+            overloadedMethod = (JPy_JOverloadedMethod*) member;
+            result = JOverloadedMethod_ResolvePendingMethods(jenv, overloadedMethod);
+            for (j = 0; j < overloadedMethod->methodCount && result == 0 && resolveMemberTypes; j++) {
+                method = overloadedMethod->methods[j];
+                for (k = 0; k < method->paramCount && result == 0; k++) {
+                    result = JType_ResolveElementType(jenv, method->paramDescriptors[k].type);
+                }
+                if (method->returnDescriptor != NULL && result == 0) {
+                    result = JType_ResolveElementType(jenv, method->returnDescriptor->type);
+                }
+            }
+        } else if (PyObject_TypeCheck(member, &JField_Type)) {
+            result = JField_ResolveType(jenv, (JPy_JField*) member);
+            if (result == 0 && resolveMemberTypes) {
+                result = JType_ResolveElementType(jenv, ((JPy_JField*) member)->type);
+            }
+        }
+    }
+
+    Py_DECREF(members);
+    return result;
+}
+
 jboolean JType_AcceptMethod(JPy_JType* declaringClass, JPy_JMethod* method)
 {
     PyObject* callable;
@@ -868,7 +1349,6 @@ int JType_ProcessMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, cons
     JPy_ParamDescriptor* paramDescriptors = NULL;
     JPy_ReturnDescriptor* returnDescriptor = NULL;
     jint paramCount;
-    JPy_JMethod* method;
 
     paramCount = (*jenv)->GetArrayLength(jenv, paramTypes);
     JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessMethod: methodName=\"%s\", paramCount=%d, isStatic=%d, mid=%p\n", methodName, paramCount, isStatic, mid);
@@ -894,6 +1374,17 @@ int JType_ProcessMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, cons
         returnDescriptor = NULL;
     }
 
+    return JType_ProcessMethod0(type, methodKey, methodName, paramCount, paramDescriptors, returnDescriptor, isStatic, mid);
+}
+
+/**
+ * Creates the method overload from the given descriptors and adds it to the type. The descriptors are owned by
+ * the method then.
+ */
+int JType_ProcessMethod0(JPy_JType* type, PyObject* methodKey, const char* methodName, int paramCount, JPy_ParamDescriptor* paramDescriptors, JPy_ReturnDescriptor* returnDescriptor, jboolean isStatic, jmethodID mid)
+{
+    JPy_JMethod* method;
+
     method = JMethod_New(type, methodKey, paramCount, paramDescriptors, returnDescriptor, isStatic, mid);
     if (method == NULL) {
         PyMem_Del(paramDescriptors);
@@ -904,6 +1395,7 @@ int JType_ProcessMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, cons
 
     if (JType_AcceptMethod(type, method)) {
         JType_InitMethodParamDescriptorFunctions(type, method);
+        JMethod_InitInvokeMethod(method);
         JType_AddMethod(type, method);
     } else {
         JMethod_Del(method);
@@ -954,17 +1446,146 @@ int JType_InitSuperType(JNIEnv* jenv, JPy_JType* type, jboolean resolve)
 }
 
 
+/**
+ * Appends the given type to the assignable types, unless it is already contained.
+ */
+static int JType_AddAssignableType(JPy_JType*** types, int* count, JPy_JType* type)
+{
+    JPy_JType** newTypes;
+    int i;
+
+    for (i = 0; i < *count; i++) {
+        if ((*types)[i] == type) {
+            return 0;
+        }
+    }
+
+    newTypes = *types;
+    PyMem_Resize(newTypes, JPy_JType*, *count + 1);
+    if (newTypes == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    newTypes[*count] = type;
+    Py_INCREF(type);
+    *types = newTypes;
+    (*count)++;
+    return 0;
+}
+
+/**
+ * Collects the super classes of the given type and all interfaces implemented by it or by its super classes,
+ * including the super interfaces of interfaces. The type itself is not included, see JType_IsAssignableTo().
+ */
+static int JType_InitAssignableTypes(JNIEnv* jenv, JPy_JType* type)
+{
+    JPy_JType** types;
+    JPy_JType* currentType;
+    JPy_JType* interfaceType;
+    jobjectArray interfaces;
+    jclass interfaceRef;
+    jint interfaceCount;
+    jint j;
+    int count;
+    int result;
+    int i;
+
+    types = NULL;
+    count = 0;
+    result = 0;
+
+    // The list grows while it is traversed, until no new types are found, starting with the type itself
+    for (i = -1; i < count && result == 0; i++) {
+        currentType = i < 0 ? type : types[i];
+        if (currentType->superType != NULL) {
+            result = JType_AddAssignableType(&types, &count, currentType->superType);
+        }
+
+        interfaces = (jobjectArray) (*jenv)->CallObjectMethod(jenv, currentType->classRef, JPy_Class_GetInterfaces_MID);
+        if (interfaces == NULL) {
+            JPy_ON_JAVA_EXCEPTION_GOTO(error);
+            continue;
+        }
+        interfaceCount = (*jenv)->GetArrayLength(jenv, interfaces);
+        for (j = 0; j < interfaceCount && result == 0; j++) {
+            interfaceRef = (*jenv)->GetObjectArrayElement(jenv, interfaces, j);
+            interfaceType = JType_GetType(jenv, interfaceRef, JNI_FALSE);
+            (*jenv)->DeleteLocalRef(jenv, interfaceRef);
+            result = interfaceType != NULL ? JType_AddAssignableType(&types, &count, interfaceType) : -1;
+        }
+        (*jenv)->DeleteLocalRef(jenv, interfaces);
+    }
+
+    if (result == 0 && types == NULL) {
+        // The type has neither super classes nor interfaces, but it mustn't be collected again
+        types = PyMem_New(JPy_JType*, 1);
+        if (types == NULL) {
+            PyErr_NoMemory();
+            result = -1;
+        }
+    }
+
+    if (result == 0) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_InitAssignableTypes: type '%s': assignableTypeCount=%d\n", type->javaName, count);
+        type->assignableTypes = types;
+        type->assignableTypeCount = count;
+        return 0;
+    }
+
+error:
+    for (i = 0; i < count; i++) {
+        Py_DECREF(types[i]);
+    }
+    PyMem_Del(types);
+    return -1;
+}
+
+/**
+ * Tests whether a value of the given type can be assigned to a variable of otherType, like Java's
+ * Class.isAssignableFrom(). For class and interface types the test compares the super classes and implemented
+ * interfaces collected on first use, so that it doesn't call into the JVM. Array types are still tested by the JVM.
+ */
+int JType_IsAssignableTo(JNIEnv* jenv, JPy_JType* type, JPy_JType* otherType)
+{
+    int i;
+
+    if (type == otherType) {
+        return 1;
+    }
+    if (type->componentType != NULL) {
+        // Array types are covariant in their component types
+        return (*jenv)->IsAssignableFrom(jenv, type->classRef, otherType->classRef) ? 1 : 0;
+    }
+    if (type->isPrimitive || otherType->isPrimitive || otherType->componentType != NULL) {
+        return 0;
+    }
+
+    if (type->assignableTypes == NULL) {
+        if (JType_InitAssignableTypes(jenv, type) < 0) {
+            // Don't let the lookup fail the call
+            PyErr_Clear();
+            return (*jenv)->IsAssignableFrom(jenv, type->classRef, otherType->classRef) ? 1 : 0;
+        }
+    }
+
+    for (i = 0; i < type->assignableTypeCount; i++) {
+        if (type->assignableTypes[i] == otherType) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
 int JType_ProcessClassConstructors(JNIEnv* jenv, JPy_JType* type)
 {
     jclass classRef;
     jobject constructors;
     jobject constructor;
-    jobject parameterTypes;
     jint modifiers;
     jint constrCount;
     jint i;
     jboolean isPublic;
-    jmethodID mid;
     PyObject* methodKey;
 
     classRef = type->classRef;
@@ -979,15 +1600,13 @@ int JType_ProcessClassConstructors(JNIEnv* jenv, JPy_JType* type)
         modifiers = (*jenv)->CallIntMethod(jenv, constructor, JPy_Constructor_GetModifiers_MID);
         isPublic = (modifiers & 0x0001) != 0;
         if (isPublic) {
-            parameterTypes = (*jenv)->CallObjectMethod(jenv, constructor, JPy_Constructor_GetParameterTypes_MID);
-            mid = (*jenv)->FromReflectedMethod(jenv, constructor);
-            JType_ProcessMethod(jenv, type, methodKey, JPy_JTYPE_ATTR_NAME_JINIT, NULL, parameterTypes, 1, mid);
-            (*jenv)->DeleteLocalRef(jenv, parameterTypes);
+            JType_AddPendingMethod(jenv, type, methodKey, constructor, NULL, NULL, JNI_TRUE, JNI_TRUE);
         }
         (*jenv)->DeleteLocalRef(jenv, constructor);
     }
 
     (*jenv)->DeleteLocalRef(jenv, constructors);
+    Py_DECREF(methodKey);
 
     return 0;
 }
@@ -1033,8 +1652,11 @@ int JType_ProcessClassFields(JNIEnv* jenv, JPy_JType* type)
             fid = (*jenv)->FromReflectedField(jenv, field);
 
             fieldName = (*jenv)->GetStringUTFChars(jenv, fieldNameStr, NULL);
-            fieldKey = Py_BuildValue("s", fieldName);
-            JType_ProcessField(jenv, type, fieldKey, fieldName, fieldTypeObj, isStatic, isFinal, fid);
+            fieldKey = JPy_INTERN_CSTR(fieldName);
+            if (fieldKey != NULL) {
+                JType_ProcessField(jenv, type, fieldKey, fieldName, fieldTypeObj, isStatic, isFinal, fid);
+                Py_DECREF(fieldKey);
+            }
             (*jenv)->ReleaseStringUTFChars(jenv, fieldNameStr, fieldName);
 
             (*jenv)->DeleteLocalRef(jenv, fieldTypeObj);
@@ -1052,15 +1674,12 @@ int JType_ProcessClassMethods(JNIEnv* jenv, JPy_JType* type)
     jobject methods;
     jobject method;
     jobject methodNameStr;
-    jobject returnType;
-    jobject parameterTypes;
     jint modifiers;
     jint methodCount;
     jint i;
     jboolean isStatic;
     jboolean isPublic;
     const char* methodName;
-    jmethodID mid;
     PyObject* methodKey;
 
     classRef = type->classRef;
@@ -1082,17 +1701,15 @@ int JType_ProcessClassMethods(JNIEnv* jenv, JPy_JType* type)
         isStatic   = (modifiers & 0x0008) != 0;
         if (isPublic) {
             methodNameStr = (*jenv)->CallObjectMethod(jenv, method, JPy_Method_GetName_MID);
-            returnType = (*jenv)->CallObjectMethod(jenv, method, JPy_Method_GetReturnType_MID);
-            parameterTypes = (*jenv)->CallObjectMethod(jenv, method, JPy_Method_GetParameterTypes_MID);
-            mid = (*jenv)->FromReflectedMethod(jenv, method);
 
             methodName = (*jenv)->GetStringUTFChars(jenv, methodNameStr, NULL);
-            methodKey = Py_BuildValue("s", methodName);
-            JType_ProcessMethod(jenv, type, methodKey, methodName, returnType, parameterTypes, isStatic, mid);
+            methodKey = JPy_INTERN_CSTR(methodName);
             (*jenv)->ReleaseStringUTFChars(jenv, methodNameStr, methodName);
+            if (methodKey != NULL) {
+                JType_AddPendingMethod(jenv, type, methodKey, method, NULL, NULL, isStatic, JNI_FALSE);
+                Py_DECREF(methodKey);
+            }
 
-            (*jenv)->DeleteLocalRef(jenv, parameterTypes);
-            (*jenv)->DeleteLocalRef(jenv, returnType);
             (*jenv)->DeleteLocalRef(jenv, methodNameStr);
         }
         (*jenv)->DeleteLocalRef(jenv, method);
@@ -1178,30 +1795,25 @@ int JType_AddFieldAttribute(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* f
         fieldValue = JPy_FromJObjectWithType(jenv, objectRef, (JPy_JType*) fieldType);
         (*jenv)->DeleteLocalRef(jenv, objectRef);
     }
-    PyDict_SetItem(typeDict, fieldName, fieldValue);
-    return 0;
-}
-
+    if (fieldValue == NULL) {
+        return -1;
+    }
+    if (PyDict_SetItem(typeDict, fieldName, fieldValue) < 0) {
+        Py_DECREF(fieldValue);
+        return -1;
+    }
+    Py_DECREF(fieldValue);
+    return 0;
+}
+
 int JType_ProcessField(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldKey, const char* fieldName, jclass fieldClassRef, jboolean isStatic, jboolean isFinal, jfieldID fid)
 {
     JPy_JField* field;
-    JPy_JType* fieldType;
-
-    fieldType = JType_GetType(jenv, fieldClassRef, JNI_FALSE);
-    if (fieldType == NULL) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessField: WARNING: Java field '%s' rejected because an error occurred during type processing\n", fieldName);
-        return -1;
-    }
 
-    if (isStatic && isFinal) {
-        // Add static final values to the JPy_JType's tp_dict.
-        // todo: Note that this is a workaround only, because the JPy_JType's tp_getattro slot is not called.
-        if (JType_AddFieldAttribute(jenv, declaringClass, fieldKey, fieldType, fid) < 0) {
-            return -1;
-        }
-    } else if (!isStatic) {
-        // Add instance field accessor to the JPy_JType's tp_dict, this will be evaluated in the JPy_JType's tp_setattro and tp_getattro slots.
-        field = JField_New(declaringClass, fieldKey, fieldType, isStatic, isFinal, fid);
+    if (!isStatic || isFinal) {
+        // Add the field accessor to the JPy_JType's tp_dict. Its type is resolved on first access. Static final
+        // fields replace themselves by their value in the tp_dict then, see JField_descr_get().
+        field = JField_New(jenv, declaringClass, fieldKey, fieldClassRef, isStatic, isFinal, fid);
         if (field == NULL) {
             JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessField: WARNING: Java field '%s' rejected because an error occurred during field instantiation\n", fieldName);
             return -1;
@@ -1253,6 +1865,679 @@ int JType_AddMethod(JPy_JType* type, JPy_JMethod* method)
     }
 }
 
+/**
+ * Adds a reflected Java method or constructor to the overloaded method of the given name, which is created if
+ * not yet present. The method is processed on first use of the overloaded method.
+ */
+int JType_AddPendingMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, jobject memberRef, PyObject* signature, jmethodID mid, jboolean isStatic, jboolean isConstructor)
+{
+    PyObject* typeDict;
+    PyObject* methodValue;
+    JPy_JOverloadedMethod* overloadedMethod;
+
+    typeDict = type->typeObj.tp_dict;
+    if (typeDict == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: missing attribute '__dict__' in JType");
+        return -1;
+    }
+
+    methodValue = PyDict_GetItem(typeDict, methodKey);
+    if (methodValue == NULL) {
+        overloadedMethod = JOverloadedMethod_New(type, methodKey, NULL);
+        if (PyDict_SetItem(typeDict, methodKey, (PyObject*) overloadedMethod) < 0) {
+            return -1;
+        }
+    } else if (PyObject_TypeCheck(methodValue, &JOverloadedMethod_Type)) {
+        overloadedMethod = (JPy_JOverloadedMethod*) methodValue;
+    } else {
+        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: expected type 'JOverloadedMethod' in '__dict__' of a JType");
+        return -1;
+    }
+
+    return JOverloadedMethod_AddPendingMethod(jenv, overloadedMethod, memberRef, signature, mid, isStatic, isConstructor);
+}
+
+/**
+ * Processes a reflected Java method or constructor added by JType_AddPendingMethod() into a method overload.
+ */
+int JType_ProcessReflectedMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, jobject memberRef, jboolean isStatic, jboolean isConstructor)
+{
+    jobject returnType;
+    jobject parameterTypes;
+    jmethodID mid;
+    int result;
+
+    if (isConstructor) {
+        returnType = NULL;
+        parameterTypes = (*jenv)->CallObjectMethod(jenv, memberRef, JPy_Constructor_GetParameterTypes_MID);
+    } else {
+        returnType = (*jenv)->CallObjectMethod(jenv, memberRef, JPy_Method_GetReturnType_MID);
+        parameterTypes = (*jenv)->CallObjectMethod(jenv, memberRef, JPy_Method_GetParameterTypes_MID);
+    }
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    mid = (*jenv)->FromReflectedMethod(jenv, memberRef);
+
+    result = JType_ProcessMethod(jenv, type, methodKey, JPy_AS_UTF8(methodKey), returnType, parameterTypes, isStatic, mid);
+
+    (*jenv)->DeleteLocalRef(jenv, parameterTypes);
+    if (returnType != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, returnType);
+    }
+    return result;
+}
+
+/**
+ * Returns the Java primitive type (borrowed ref) denoted by the given JNI signature character, or NULL.
+ */
+JPy_JType* JType_GetPrimitiveTypeForSignature(char signature)
+{
+    switch (signature) {
+        case 'Z': return JPy_JBoolean;
+        case 'C': return JPy_JChar;
+        case 'B': return JPy_JByte;
+        case 'S': return JPy_JShort;
+        case 'I': return JPy_JInt;
+        case 'J': return JPy_JLong;
+        case 'F': return JPy_JFloat;
+        case 'D': return JPy_JDouble;
+        case 'V': return JPy_JVoid;
+        default: return NULL;
+    }
+}
+
+/**
+ * Returns the JNI signature character of the Java primitive type with the given name, or 0 if it is not primitive.
+ */
+char JType_GetSignatureForPrimitiveName(const char* typeName)
+{
+    if (strcmp(typeName, "boolean") == 0) {
+        return 'Z';
+    } else if (strcmp(typeName, "char") == 0) {
+        return 'C';
+    } else if (strcmp(typeName, "byte") == 0) {
+        return 'B';
+    } else if (strcmp(typeName, "short") == 0) {
+        return 'S';
+    } else if (strcmp(typeName, "int") == 0) {
+        return 'I';
+    } else if (strcmp(typeName, "long") == 0) {
+        return 'J';
+    } else if (strcmp(typeName, "float") == 0) {
+        return 'F';
+    } else if (strcmp(typeName, "double") == 0) {
+        return 'D';
+    } else if (strcmp(typeName, "void") == 0) {
+        return 'V';
+    }
+    return 0;
+}
+
+/**
+ * Returns the end of the JNI type signature starting at the given position, or NULL if it is malformed.
+ */
+const char* JType_SkipTypeSignature(const char* signature)
+{
+    while (*signature == '[') {
+        signature++;
+    }
+    if (*signature == 'L') {
+        signature = strchr(signature, ';');
+        return signature != NULL ? signature + 1 : NULL;
+    }
+    return JType_GetPrimitiveTypeForSignature(*signature) != NULL ? signature + 1 : NULL;
+}
+
+/**
+ * Returns a local reference to the Java class given by the JNI type signature in the range [start, end), e.g. "I",
+ * "Ljava/lang/String;" or "[[D". Returns NULL and sets a Python exception if the class can't be found.
+ */
+jclass JType_FindClassForSignature(JNIEnv* jenv, const char* start, const char* end)
+{
+    JPy_JType* primitiveType;
+    char* className;
+    size_t length;
+    jclass classRef;
+
+    if (end - start == 1) {
+        primitiveType = JType_GetPrimitiveTypeForSignature(*start);
+        if (primitiveType != NULL) {
+            return (*jenv)->NewLocalRef(jenv, primitiveType->classRef);
+        }
+    }
+
+    // FindClass() expects "java/lang/String" for object types, but the signature itself for array types
+    if (*start == 'L') {
+        start++;
+        end--;
+    }
+    length = end - start;
+    className = PyMem_New(char, length + 1);
+    if (className == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    memcpy(className, start, length);
+    className[length] = 0;
+
+    classRef = (*jenv)->FindClass(jenv, className);
+    if (classRef == NULL || (*jenv)->ExceptionCheck(jenv)) {
+        (*jenv)->ExceptionClear(jenv);
+        PyErr_Format(PyExc_ValueError, "Java class '%s' not found", className);
+        classRef = NULL;
+    }
+
+    PyMem_Del(className);
+    return classRef;
+}
+
+/**
+ * Returns the type (borrowed ref) given by the JNI type signature starting at *signature and moves *signature behind it.
+ * Returns NULL and sets a Python exception on failure.
+ */
+JPy_JType* JType_GetTypeForSignature(JNIEnv* jenv, const char** signature)
+{
+    const char* start;
+    const char* end;
+    JPy_JType* type;
+    jclass classRef;
+
+    start = *signature;
+    end = JType_SkipTypeSignature(start);
+    if (end == NULL) {
+        PyErr_Format(PyExc_ValueError, "malformed Java type signature '%s'", start);
+        return NULL;
+    }
+    *signature = end;
+
+    if (end - start == 1) {
+        return JType_GetPrimitiveTypeForSignature(*start);
+    }
+
+    classRef = JType_FindClassForSignature(jenv, start, end);
+    if (classRef == NULL) {
+        return NULL;
+    }
+    type = JType_GetType(jenv, classRef, JNI_FALSE);
+    (*jenv)->DeleteLocalRef(jenv, classRef);
+    return type;
+}
+
+void JType_DelParamDescriptors(JPy_ParamDescriptor* paramDescriptors, int paramCount)
+{
+    int i;
+    for (i = 0; i < paramCount; i++) {
+        Py_DECREF(paramDescriptors[i].type);
+    }
+    PyMem_Del(paramDescriptors);
+}
+
+/**
+ * Processes a Java method or constructor given by its JNI signature and method ID into a method overload, see
+ * JType_ProcessClassMetadata(). Its parameter and return types are looked up by the class names in the signature.
+ */
+int JType_ProcessMethodSignature(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, PyObject* signature, jboolean isStatic, jboolean isConstructor, jmethodID mid)
+{
+    JPy_ParamDescriptor* paramDescriptors;
+    JPy_ReturnDescriptor* returnDescriptor;
+    JPy_JType* paramType;
+    JPy_JType* returnType;
+    const char* methodName;
+    const char* cursor;
+    const char* end;
+    int paramCount;
+    int i;
+
+    methodName = JPy_AS_UTF8(methodKey);
+    cursor = JPy_AS_UTF8(signature);
+
+    paramCount = 0;
+    end = cursor[0] == '(' ? cursor + 1 : NULL;
+    while (end != NULL && *end != ')') {
+        end = JType_SkipTypeSignature(end);
+        paramCount++;
+    }
+    if (end == NULL) {
+        PyErr_Format(PyExc_ValueError, "malformed Java method signature '%s'", cursor);
+        return -1;
+    }
+    cursor++;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessMethodSignature: methodName=\"%s\", signature=\"%s\"\n", methodName, cursor - 1);
+
+    paramDescriptors = NULL;
+    if (paramCount > 0) {
+        paramDescriptors = PyMem_New(JPy_ParamDescriptor, paramCount);
+        if (paramDescriptors == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        for (i = 0; i < paramCount; i++) {
+            paramType = JType_GetTypeForSignature(jenv, &cursor);
+            if (paramType == NULL) {
+                JType_DelParamDescriptors(paramDescriptors, i);
+                JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessMethodSignature: WARNING: Java method '%s' rejected because an error occurred during parameter type processing\n", methodName);
+                return -1;
+            }
+            JType_InitParamDescriptor(paramDescriptors + i, paramType);
+        }
+    }
+    // Skip ')'
+    cursor++;
+
+    returnDescriptor = NULL;
+    if (!isConstructor) {
+        returnType = JType_GetTypeForSignature(jenv, &cursor);
+        if (returnType != NULL) {
+            returnDescriptor = PyMem_New(JPy_ReturnDescriptor, 1);
+            if (returnDescriptor == NULL) {
+                PyErr_NoMemory();
+            }
+        }
+        if (returnDescriptor == NULL) {
+            JType_DelParamDescriptors(paramDescriptors, paramCount);
+            JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessMethodSignature: WARNING: Java method '%s' rejected because an error occurred during return type processing\n", methodName);
+            return -1;
+        }
+        returnDescriptor->type = returnType;
+        returnDescriptor->paramIndex = -1;
+        Py_INCREF((PyObject*) returnType);
+    }
+
+    return JType_ProcessMethod0(type, methodKey, methodName, paramCount, paramDescriptors, returnDescriptor, isStatic, mid);
+}
+
+/**
+ * The IDs of a member given by the type metadata, which are looked up before any member is added to a type.
+ */
+typedef struct
+{
+    jmethodID mid;
+    jfieldID fid;
+    // Local reference to the class of a field, NULL for methods.
+    jclass fieldClassRef;
+}
+JPy_MemberIDs;
+
+/**
+ * Fills the type __dict__ with the constructors, methods and fields given by its type metadata, see
+ * jpy.set_type_metadata(). The type metadata is a (declaredCount, members) tuple. The members are looked up by their
+ * JNI signatures, which avoids reflecting them.
+ * Returns 1 without adding any member if the number of members declared by the class differs from declaredCount or
+ * a member can't be bound, e.g. because the class has changed since its metadata was taken, so that the class
+ * members must be reflected and the metadata is discarded. A negative declaredCount skips the member count check,
+ * which is used for the metadata reflected by jpy.preload() in this process.
+ * Returns -1 and sets a Python exception on failure.
+ */
+int JType_ProcessClassMetadata(JNIEnv* jenv, JPy_JType* type, PyObject* typeMetadata)
+{
+    JPy_MemberIDs* memberIDs;
+    PyObject* members;
+    PyObject* member;
+    PyObject* memberKey;
+    PyObject* signatureObj;
+    PyObject* jinitKey = NULL;
+    const char* memberName;
+    const char* signature;
+    jint modifiers;
+    jboolean isStatic;
+    jboolean isFinal;
+    long declaredCount;
+    Py_ssize_t memberCount;
+    Py_ssize_t foundCount;
+    Py_ssize_t i;
+    int result;
+
+    declaredCount = JPy_AS_CLONG(PyTuple_GET_ITEM(typeMetadata, 0));
+    members = PyTuple_GET_ITEM(typeMetadata, 1);
+    memberCount = PyTuple_GET_SIZE(members);
+    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessClassMetadata: type->javaName=\"%s\", declaredCount=%ld, memberCount=%d\n", type->javaName, declaredCount, (int) memberCount);
+
+    // Members added to the class or moved to a super class since the metadata was taken would go unnoticed by
+    // GetMethodID(), which also finds inherited methods, so check the number of declared members first
+    if (declaredCount >= 0) {
+        result = JType_GetDeclaredMemberCount(jenv, type);
+        if (result < 0) {
+            return -1;
+        }
+        if (result != declaredCount) {
+            JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessClassMetadata: type->javaName=\"%s\" declares %d members, class members will be reflected\n", type->javaName, result);
+            return 1;
+        }
+    }
+
+    memberIDs = PyMem_New(JPy_MemberIDs, memberCount + 1);
+    if (memberIDs == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    // Look up all members first, so that a class' members are either all taken from its metadata or all reflected
+    result = 0;
+    for (foundCount = 0; foundCount < memberCount; foundCount++) {
+        member = PyTuple_GET_ITEM(members, foundCount);
+        memberName = JPy_AS_UTF8(PyTuple_GET_ITEM(member, 0));
+        modifiers = (jint) JPy_AS_CLONG(PyTuple_GET_ITEM(member, 1));
+        signature = JPy_AS_UTF8(PyTuple_GET_ITEM(member, 2));
+        isStatic = (modifiers & 0x0008) != 0;
+
+        memberIDs[foundCount].mid = NULL;
+        memberIDs[foundCount].fid = NULL;
+        memberIDs[foundCount].fieldClassRef = NULL;
+        if (signature[0] == '(') {
+            if (isStatic && strcmp(memberName, "<init>") != 0) {
+                memberIDs[foundCount].mid = (*jenv)->GetStaticMethodID(jenv, type->classRef, memberName, signature);
+            } else {
+                memberIDs[foundCount].mid = (*jenv)->GetMethodID(jenv, type->classRef, memberName, signature);
+            }
+        } else {
+            if (isStatic) {
+                memberIDs[foundCount].fid = (*jenv)->GetStaticFieldID(jenv, type->classRef, memberName, signature);
+            } else {
+                memberIDs[foundCount].fid = (*jenv)->GetFieldID(jenv, type->classRef, memberName, signature);
+            }
+            if (memberIDs[foundCount].fid != NULL) {
+                memberIDs[foundCount].fieldClassRef = JType_FindClassForSignature(jenv, signature, signature + strlen(signature));
+            }
+        }
+
+        if (memberIDs[foundCount].mid == NULL && memberIDs[foundCount].fieldClassRef == NULL) {
+            (*jenv)->ExceptionClear(jenv);
+            PyErr_Clear();
+            JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessClassMetadata: member '%s' with signature '%s' not found, class members will be reflected\n", memberName, signature);
+            result = 1;
+            break;
+        }
+    }
+
+    if (result == 0) {
+        jinitKey = JPy_INTERN_CSTR(JPy_JTYPE_ATTR_NAME_JINIT);
+        if (jinitKey == NULL) {
+            result = -1;
+        }
+    }
+
+    for (i = 0; i < memberCount && result == 0; i++) {
+        member = PyTuple_GET_ITEM(members, i);
+        memberKey = PyTuple_GET_ITEM(member, 0);
+        memberName = JPy_AS_UTF8(memberKey);
+        modifiers = (jint) JPy_AS_CLONG(PyTuple_GET_ITEM(member, 1));
+        signatureObj = PyTuple_GET_ITEM(member, 2);
+        isStatic = (modifiers & 0x0008) != 0;
+        isFinal  = (modifiers & 0x0010) != 0;
+
+        if (memberIDs[i].mid == NULL) {
+            result = JType_ProcessField(jenv, type, memberKey, memberName, memberIDs[i].fieldClassRef, isStatic, isFinal, memberIDs[i].fid);
+        } else if (strcmp(memberName, "<init>") == 0) {
+            result = JType_AddPendingMethod(jenv, type, jinitKey, NULL, signatureObj, memberIDs[i].mid, JNI_TRUE, JNI_TRUE);
+        } else {
+            result = JType_AddPendingMethod(jenv, type, memberKey, NULL, signatureObj, memberIDs[i].mid, isStatic, JNI_FALSE);
+        }
+    }
+
+    Py_XDECREF(jinitKey);
+
+    for (i = 0; i < foundCount; i++) {
+        if (memberIDs[i].fieldClassRef != NULL) {
+            (*jenv)->DeleteLocalRef(jenv, memberIDs[i].fieldClassRef);
+        }
+    }
+    PyMem_Del(memberIDs);
+    return result;
+}
+
+int JType_AppendSignatureChar(char** signature, size_t* length, char c)
+{
+    char* buffer = *signature;
+    PyMem_Resize(buffer, char, *length + 2);
+    if (buffer == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    buffer[(*length)++] = c;
+    buffer[*length] = 0;
+    *signature = buffer;
+    return 0;
+}
+
+/**
+ * Appends the JNI type signature of the given class to the signature buffer.
+ */
+int JType_AppendClassSignature(JNIEnv* jenv, jclass classRef, char** signature, size_t* length)
+{
+    jstring nameStr;
+    const char* name;
+    char primitiveSignature;
+    char* buffer;
+    char* c;
+    int i;
+
+    nameStr = (*jenv)->CallObjectMethod(jenv, classRef, JPy_Class_GetName_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    name = (*jenv)->GetStringUTFChars(jenv, nameStr, NULL);
+
+    buffer = *signature;
+    PyMem_Resize(buffer, char, *length + strlen(name) + 3);
+    if (buffer == NULL) {
+        (*jenv)->ReleaseStringUTFChars(jenv, nameStr, name);
+        (*jenv)->DeleteLocalRef(jenv, nameStr);
+        PyErr_NoMemory();
+        return -1;
+    }
+    *signature = buffer;
+
+    c = buffer + *length;
+    primitiveSignature = JType_GetSignatureForPrimitiveName(name);
+    if (primitiveSignature != 0) {
+        *c++ = primitiveSignature;
+    } else {
+        // Array class names are signatures already, except that they use dots instead of slashes
+        if (name[0] != '[') {
+            *c++ = 'L';
+        }
+        for (i = 0; name[i] != 0; i++) {
+            *c++ = name[i] == '.' ? '/' : name[i];
+        }
+        if (name[0] != '[') {
+            *c++ = ';';
+        }
+    }
+    *c = 0;
+    *length = c - buffer;
+
+    (*jenv)->ReleaseStringUTFChars(jenv, nameStr, name);
+    (*jenv)->DeleteLocalRef(jenv, nameStr);
+    return 0;
+}
+
+/**
+ * Returns the JNI signature of a field of the given type class, or of a method if paramClasses is given (new reference).
+ */
+PyObject* JType_GetSignature(JNIEnv* jenv, jarray paramClasses, jclass typeClass)
+{
+    PyObject* result;
+    char* signature;
+    size_t length;
+    jclass paramClass;
+    jint paramCount;
+    jint i;
+
+    signature = NULL;
+    length = 0;
+    if (paramClasses != NULL) {
+        if (JType_AppendSignatureChar(&signature, &length, '(') < 0) {
+            return NULL;
+        }
+        paramCount = (*jenv)->GetArrayLength(jenv, paramClasses);
+        for (i = 0; i < paramCount; i++) {
+            paramClass = (*jenv)->GetObjectArrayElement(jenv, paramClasses, i);
+            if (JType_AppendClassSignature(jenv, paramClass, &signature, &length) < 0) {
+                (*jenv)->DeleteLocalRef(jenv, paramClass);
+                PyMem_Del(signature);
+                return NULL;
+            }
+            (*jenv)->DeleteLocalRef(jenv, paramClass);
+        }
+        if (JType_AppendSignatureChar(&signature, &length, ')') < 0) {
+            PyMem_Del(signature);
+            return NULL;
+        }
+    }
+    if (JType_AppendClassSignature(jenv, typeClass, &signature, &length) < 0) {
+        PyMem_Del(signature);
+        return NULL;
+    }
+
+    result = JPy_FROM_CSTR(signature);
+    PyMem_Del(signature);
+    return result;
+}
+
+#define JPy_MEMBER_KIND_CONSTRUCTOR 0
+#define JPy_MEMBER_KIND_METHOD      1
+#define JPy_MEMBER_KIND_FIELD       2
+
+/**
+ * Appends the (name, modifiers, signature) tuples of the public ones of the given reflected members to memberList.
+ */
+int JType_AppendMemberMetadata(JNIEnv* jenv, PyObject* memberList, jarray members, int memberKind)
+{
+    jobject member;
+    jobject nameStr;
+    jobject typeClass;
+    jobject paramClasses;
+    jint modifiers;
+    jint memberCount;
+    jint i;
+    PyObject* name;
+    PyObject* signature;
+    PyObject* item;
+
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    memberCount = (*jenv)->GetArrayLength(jenv, members);
+    for (i = 0; i < memberCount; i++) {
+        member = (*jenv)->GetObjectArrayElement(jenv, members, i);
+        if (memberKind == JPy_MEMBER_KIND_CONSTRUCTOR) {
+            modifiers = (*jenv)->CallIntMethod(jenv, member, JPy_Constructor_GetModifiers_MID);
+        } else if (memberKind == JPy_MEMBER_KIND_METHOD) {
+            modifiers = (*jenv)->CallIntMethod(jenv, member, JPy_Method_GetModifiers_MID);
+        } else {
+            modifiers = (*jenv)->CallIntMethod(jenv, member, JPy_Field_GetModifiers_MID);
+        }
+        // see http://docs.oracle.com/javase/6/docs/api/constant-values.html#java.lang.reflect.Modifier.PUBLIC
+        if ((modifiers & 0x0001) == 0) {
+            (*jenv)->DeleteLocalRef(jenv, member);
+            continue;
+        }
+
+        if (memberKind == JPy_MEMBER_KIND_CONSTRUCTOR) {
+            paramClasses = (*jenv)->CallObjectMethod(jenv, member, JPy_Constructor_GetParameterTypes_MID);
+            name = JPy_FROM_CSTR("<init>");
+            signature = JType_GetSignature(jenv, paramClasses, JPy_JVoid->classRef);
+            (*jenv)->DeleteLocalRef(jenv, paramClasses);
+        } else if (memberKind == JPy_MEMBER_KIND_METHOD) {
+            nameStr = (*jenv)->CallObjectMethod(jenv, member, JPy_Method_GetName_MID);
+            paramClasses = (*jenv)->CallObjectMethod(jenv, member, JPy_Method_GetParameterTypes_MID);
+            typeClass = (*jenv)->CallObjectMethod(jenv, member, JPy_Method_GetReturnType_MID);
+            name = JPy_FromJString(jenv, nameStr);
+            signature = JType_GetSignature(jenv, paramClasses, typeClass);
+            (*jenv)->DeleteLocalRef(jenv, typeClass);
+            (*jenv)->DeleteLocalRef(jenv, paramClasses);
+            (*jenv)->DeleteLocalRef(jenv, nameStr);
+        } else {
+            nameStr = (*jenv)->CallObjectMethod(jenv, member, JPy_Field_GetName_MID);
+            typeClass = (*jenv)->CallObjectMethod(jenv, member, JPy_Field_GetType_MID);
+            name = JPy_FromJString(jenv, nameStr);
+            signature = JType_GetSignature(jenv, NULL, typeClass);
+            (*jenv)->DeleteLocalRef(jenv, typeClass);
+            (*jenv)->DeleteLocalRef(jenv, nameStr);
+        }
+        (*jenv)->DeleteLocalRef(jenv, member);
+
+        if (name == NULL || signature == NULL) {
+            Py_XDECREF(name);
+            Py_XDECREF(signature);
+            return -1;
+        }
+        item = Py_BuildValue("(NiN)", name, (int) modifiers, signature);
+        if (item == NULL || PyList_Append(memberList, item) < 0) {
+            Py_XDECREF(item);
+            return -1;
+        }
+        Py_DECREF(item);
+    }
+    return 0;
+}
+
+/**
+ * Returns the number of constructors, methods and fields declared by the given type, including non-public ones.
+ * Interfaces count all their public methods and fields, including inherited ones, as JType_ResolveType() does.
+ * Returns -1 and sets a Python exception on failure.
+ */
+int JType_GetDeclaredMemberCount(JNIEnv* jenv, JPy_JType* type)
+{
+    jmethodID mids[3];
+    jobject members;
+    int count;
+    int i;
+
+    mids[0] = JPy_Class_GetDeclaredConstructors_MID;
+    mids[1] = type->isInterface ? JPy_Class_GetMethods_MID : JPy_Class_GetDeclaredMethods_MID;
+    mids[2] = type->isInterface ? JPy_Class_GetFields_MID : JPy_Class_GetDeclaredFields_MID;
+
+    count = 0;
+    for (i = 0; i < 3; i++) {
+        members = (*jenv)->CallObjectMethod(jenv, type->classRef, mids[i]);
+        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+        count += (*jenv)->GetArrayLength(jenv, members);
+        (*jenv)->DeleteLocalRef(jenv, members);
+    }
+    return count;
+}
+
+/**
+ * Returns a new (declaredCount, members) tuple describing the given type, where members is a list of
+ * (name, modifiers, signature) tuples, one for each public constructor, method and field of the type, as they are
+ * processed by JType_ResolveType(). Constructors are named "<init>". declaredCount is the number of all members
+ * declared by the type, see JType_GetDeclaredMemberCount(). See jpy.get_type_metadata().
+ */
+PyObject* JType_GetMemberMetadata(JNIEnv* jenv, JPy_JType* type)
+{
+    PyObject* memberList;
+    jclass classRef;
+    jobject members;
+    int declaredCount;
+    int result;
+
+    memberList = PyList_New(0);
+    if (memberList == NULL) {
+        return NULL;
+    }
+
+    classRef = type->classRef;
+    members = (*jenv)->CallObjectMethod(jenv, classRef, JPy_Class_GetDeclaredConstructors_MID);
+    result = JType_AppendMemberMetadata(jenv, memberList, members, JPy_MEMBER_KIND_CONSTRUCTOR);
+    (*jenv)->DeleteLocalRef(jenv, members);
+
+    if (result == 0) {
+        members = (*jenv)->CallObjectMethod(jenv, classRef, type->isInterface ? JPy_Class_GetMethods_MID : JPy_Class_GetDeclaredMethods_MID);
+        result = JType_AppendMemberMetadata(jenv, memberList, members, JPy_MEMBER_KIND_METHOD);
+        (*jenv)->DeleteLocalRef(jenv, members);
+    }
+
+    if (result == 0) {
+        members = (*jenv)->CallObjectMethod(jenv, classRef, type->isInterface ? JPy_Class_GetFields_MID : JPy_Class_GetDeclaredFields_MID);
+        result = JType_AppendMemberMetadata(jenv, memberList, members, JPy_MEMBER_KIND_FIELD);
+        (*jenv)->DeleteLocalRef(jenv, members);
+    }
+
+    declaredCount = result == 0 ? JType_GetDeclaredMemberCount(jenv, type) : -1;
+    if (result < 0 || declaredCount < 0) {
+        Py_DECREF(memberList);
+        return NULL;
+    }
+    return Py_BuildValue("(iN)", declaredCount, memberList);
+}
+
 /**
  * Returns NULL (error), Py_None (borrowed ref), or a JPy_JOverloadedMethod* (borrowed ref)
  */
@@ -1342,19 +2627,24 @@ JPy_ParamDescriptor* JType_CreateParamDescriptors(JNIEnv* jenv, int paramCount,
             return NULL;
         }
 
-        paramDescriptor->type = type;
-        Py_INCREF((PyObject*) paramDescriptor->type);
-
-        paramDescriptor->isMutable = 0;
-        paramDescriptor->isOutput = 0;
-        paramDescriptor->isReturn = 0;
-        paramDescriptor->MatchPyArg = NULL;
-        paramDescriptor->ConvertPyArg = NULL;
+        JType_InitParamDescriptor(paramDescriptor, type);
     }
 
     return paramDescriptors;
 }
 
+void JType_InitParamDescriptor(JPy_ParamDescriptor* paramDescriptor, JPy_JType* type)
+{
+    paramDescriptor->type = type;
+    Py_INCREF((PyObject*) paramDescriptor->type);
+
+    paramDescriptor->isMutable = 0;
+    paramDescriptor->isOutput = 0;
+    paramDescriptor->isReturn = 0;
+    paramDescriptor->MatchPyArg = NULL;
+    paramDescriptor->ConvertPyArg = NULL;
+}
+
 int JType_MatchPyArgAsJBooleanParam(JNIEnv* jenv, JPy_ParamDescriptor* paramDescriptor, PyObject* pyArg)
 {
     if (PyBool_Check(pyArg)) return 100;
@@ -1482,6 +2772,115 @@ int JType_ConvertPyArgToJStringArg(JNIEnv* jenv, JPy_ParamDescriptor* paramDescr
     return JPy_AsJString(jenv, pyArg, &value->l);
 }
 
+/**
+ * A Python buffer object inspected by overload matching for a primitive array parameter and its buffer, which is
+ * kept acquired so that matching further overloads and finally converting the argument don't acquire it again.
+ */
+typedef struct
+{
+    PyObject* obj;
+    Py_buffer view;
+}
+JType_ArgBuffer;
+
+/**
+ * The argument buffers of the current call, one for each distinct buffer argument and identified by the argument
+ * object. Calls hold the GIL between matching and conversion. The buffers are released by JType_ReleaseArgBuffer()
+ * once the call's arguments are converted.
+ */
+static JType_ArgBuffer JType_ArgBuffers[JPy_METHOD_CACHE_MAX_ARGS];
+// Index of the argument buffer to be evicted next if all are in use.
+static int JType_ArgBufferNext = 0;
+
+/**
+ * Gets the item format and size of the buffer of the given Python argument, acquiring the buffer if it's not an
+ * argument buffer already. Returns -1 if the argument doesn't provide a contiguous buffer.
+ */
+static int JType_GetArgBufferFormat(PyObject* pyArg, char* format, Py_ssize_t* itemSize)
+{
+    JType_ArgBuffer* argBuffer;
+    PyObject* oldObj;
+    Py_buffer oldView;
+    Py_buffer view;
+    int i;
+
+    for (i = 0; i < JPy_METHOD_CACHE_MAX_ARGS; i++) {
+        if (JType_ArgBuffers[i].obj == pyArg) {
+            *format = JType_ArgBuffers[i].view.format != NULL ? *JType_ArgBuffers[i].view.format : '\0';
+            *itemSize = JType_ArgBuffers[i].view.itemsize;
+            return 0;
+        }
+    }
+
+    if (PyObject_GetBuffer(pyArg, &view, PyBUF_FORMAT) < 0) {
+        PyErr_Clear();
+        return -1;
+    }
+    *format = view.format != NULL ? *view.format : '\0';
+    *itemSize = view.itemsize;
+
+    argBuffer = NULL;
+    for (i = 0; i < JPy_METHOD_CACHE_MAX_ARGS && argBuffer == NULL; i++) {
+        if (JType_ArgBuffers[i].obj == NULL) {
+            argBuffer = &JType_ArgBuffers[i];
+        }
+    }
+    if (argBuffer == NULL) {
+        // More buffer arguments than slots, the evicted one is acquired again if it's needed
+        argBuffer = &JType_ArgBuffers[JType_ArgBufferNext];
+        JType_ArgBufferNext = (JType_ArgBufferNext + 1) % JPy_METHOD_CACHE_MAX_ARGS;
+    }
+
+    oldObj = argBuffer->obj;
+    oldView = argBuffer->view;
+    argBuffer->obj = pyArg;
+    argBuffer->view = view;
+    if (oldObj != NULL) {
+        // Releasing the buffer may run Python code, but the format and size have already been read
+        PyBuffer_Release(&oldView);
+    }
+    return 0;
+}
+
+/**
+ * Passes the ownership of the argument buffer to the caller, if it has been acquired for the given Python argument
+ * and is writable, if required. Returns 1 if so, 0 otherwise.
+ */
+static int JType_TakeArgBuffer(PyObject* pyArg, jboolean writable, Py_buffer* view)
+{
+    int i;
+
+    for (i = 0; i < JPy_METHOD_CACHE_MAX_ARGS; i++) {
+        if (JType_ArgBuffers[i].obj == pyArg) {
+            if (writable && JType_ArgBuffers[i].view.readonly) {
+                return 0;
+            }
+            *view = JType_ArgBuffers[i].view;
+            JType_ArgBuffers[i].obj = NULL;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Releases the buffers acquired by overload matching, if any. Called after a call's arguments have been converted.
+ */
+void JType_ReleaseArgBuffer(void)
+{
+    Py_buffer view;
+    int i;
+
+    for (i = 0; i < JPy_METHOD_CACHE_MAX_ARGS; i++) {
+        if (JType_ArgBuffers[i].obj != NULL) {
+            // Releasing the buffer may run Python code
+            view = JType_ArgBuffers[i].view;
+            JType_ArgBuffers[i].obj = NULL;
+            PyBuffer_Release(&view);
+        }
+    }
+}
+
 int JType_MatchPyArgAsJObjectParam(JNIEnv* jenv, JPy_ParamDescriptor* paramDescriptor, PyObject* pyArg)
 {
     return JType_MatchPyArgAsJObject(jenv, paramDescriptor->type, pyArg);
@@ -1510,16 +2909,18 @@ int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyAr
             return 100;
         }
 
+        // The Python type of a Java object is the declared type, which may be a super type of the actual one.
+        // Only if the declared type is not known to be assignable, the JVM has to check the object itself.
         argValue = (JPy_JObj*) pyArg;
-        if ((*jenv)->IsInstanceOf(jenv, argValue->objectRef, paramType->classRef)) {
+        if ((argType->componentType == NULL && JType_IsAssignableTo(jenv, argType, paramType))
+            || (*jenv)->IsInstanceOf(jenv, argValue->objectRef, paramType->classRef)) {
             argComponentType = argType->componentType;
             if (argComponentType == paramComponentType) {
                 // pyArg is an instance of parameter type, and they both have the same component types (which may be null)
                 return 90;
             }
             if (argComponentType != NULL && paramComponentType != NULL) {
-                // Determines whether an object of clazz1 can be safely cast to clazz2.
-                if ((*jenv)->IsAssignableFrom(jenv, argComponentType->classRef, paramComponentType->classRef)) {
+                if (JType_IsAssignableTo(jenv, argComponentType, paramComponentType)) {
                     // pyArg is an instance of parameter array type, and component types are compatible
                     return 80;
                 }
@@ -1538,80 +2939,78 @@ int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyAr
         // The parameter type is an array type
 
         if (paramComponentType->isPrimitive && PyObject_CheckBuffer(pyArg)) {
-            Py_buffer view;
+            char format;
+            Py_ssize_t itemSize;
 
             // The parameter type is a primitive array type, pyArg is a Python buffer object
 
-            if (PyObject_GetBuffer(pyArg, &view, PyBUF_FORMAT) == 0) {
+            if (JType_GetArgBufferFormat(pyArg, &format, &itemSize) == 0) {
                 JPy_JType* type;
                 int matchValue;
 
-                //printf("JType_AssessToJObject: buffer len=%d, itemsize=%d, format=%s\n", view.len, view.itemsize, view.format);
-
                 type = paramComponentType;
                 matchValue = 0;
-                if (view.format != NULL) {
-                    char format = *view.format;
+                if (format != '\0') {
                     if (type == JPy_JBoolean) {
                         matchValue = format == 'b' || format == 'B' ? 100
-                                   : view.itemsize == 1 ? 10
+                                   : itemSize == 1 ? 10
                                    : 0;
                     } else if (type == JPy_JByte) {
                         matchValue = format == 'b' ? 100
                                    : format == 'B' ? 90
-                                   : view.itemsize == 1 ? 10
+                                   : itemSize == 1 ? 10
                                    : 0;
                     } else if (type == JPy_JChar) {
                         matchValue = format == 'u' ? 100
                                    : format == 'H' ? 90
                                    : format == 'h' ? 80
-                                   : view.itemsize == 2 ? 10
+                                   : itemSize == 2 ? 10
                                    : 0;
                     } else if (type == JPy_JShort) {
                         matchValue = format == 'h' ? 100
                                    : format == 'H' ? 90
-                                   : view.itemsize == 2 ? 10
+                                   : itemSize == 2 ? 10
                                    : 0;
                     } else if (type == JPy_JInt) {
                         matchValue = format == 'i' || format == 'l' ? 100
                                    : format == 'I' || format == 'L' ? 90
-                                   : view.itemsize == 4 ? 10
+                                   : itemSize == 4 ? 10
                                    : 0;
                     } else if (type == JPy_JLong) {
                         matchValue = format == 'q' ? 100
                                    : format == 'Q' ? 90
-                                   : view.itemsize == 8 ? 10
+                                   : itemSize == 8 ? 10
                                    : 0;
                     } else if (type == JPy_JFloat) {
                         matchValue = format == 'f' ? 100
-                                   : view.itemsize == 4 ? 10
+                                   : itemSize == 4 ? 10
                                    : 0;
                     } else if (type == JPy_JDouble) {
                         matchValue = format == 'd' ? 100
-                                   : view.itemsize == 8 ? 10
+                                   : itemSize == 8 ? 10
                                    : 0;
                     }
                 } else {
                     if (type == JPy_JBoolean) {
-                        matchValue = view.itemsize == 1 ? 10 : 0;
+                        matchValue = itemSize == 1 ? 10 : 0;
                     } else if (type == JPy_JByte) {
-                        matchValue = view.itemsize == 1 ? 10 : 0;
+                        matchValue = itemSize == 1 ? 10 : 0;
                     } else if (type == JPy_JChar) {
-                        matchValue = view.itemsize == 2 ? 10 : 0;
+                        matchValue = itemSize == 2 ? 10 : 0;
                     } else if (type == JPy_JShort) {
-                        matchValue = view.itemsize == 2 ? 10 : 0;
+                        matchValue = itemSize == 2 ? 10 : 0;
                     } else if (type == JPy_JInt) {
-                        matchValue = view.itemsize == 4 ? 10 : 0;
+                        matchValue = itemSize == 4 ? 10 : 0;
                     } else if (type == JPy_JLong) {
-                        matchValue = view.itemsize == 8 ? 10 : 0;
+                        matchValue = itemSize == 8 ? 10 : 0;
                     } else if (type == JPy_JFloat) {
-                        matchValue = view.itemsize == 4 ? 10 : 0;
+                        matchValue = itemSize == 4 ? 10 : 0;
                     } else if (type == JPy_JDouble) {
-                        matchValue = view.itemsize == 8 ? 10 : 0;
+                        matchValue = itemSize == 8 ? 10 : 0;
                     }
                 }
 
-                PyBuffer_Release(&view);
+                // The buffer is kept for the next overloads and the conversion of the argument
                 return matchValue;
             }
         } else if (PySequence_Check(pyArg)) {
@@ -1650,6 +3049,33 @@ int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyAr
     return 0;
 }
 
+/**
+ * Tests whether the value returned by JType_MatchPyArgAsJObject() for the given argument only depends on the
+ * argument's Python type, so that it will be the same for any other argument of that type.
+ */
+int JType_IsTypeStableMatch(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyArg)
+{
+    JPy_JType* paramComponentType;
+
+    if (JObj_Check(pyArg)) {
+        JPy_JType* argType = (JPy_JType*) Py_TYPE(pyArg);
+        if (argType == paramType) {
+            return 1;
+        }
+        // The Python type of a Java object is the declared type, which may be a super type of the actual one.
+        // IsInstanceOf() gives the same result for all objects of argType only if argType is assignable to paramType.
+        return JType_IsAssignableTo(jenv, argType, paramType);
+    }
+
+    paramComponentType = paramType->componentType;
+    if (paramComponentType != NULL && paramComponentType->isPrimitive && PyObject_CheckBuffer(pyArg)) {
+        // The match value depends on the buffer's actual item format
+        return 0;
+    }
+
+    return 1;
+}
+
 int JType_ConvertPyArgToJObjectArg(JNIEnv* jenv, JPy_ParamDescriptor* paramDescriptor, PyObject* pyArg, jvalue* value, JPy_ArgDisposer* disposer)
 {
     if (pyArg == Py_None) {
@@ -1684,10 +3110,13 @@ int JType_ConvertPyArgToJObjectArg(JNIEnv* jenv, JPy_ParamDescriptor* paramDescr
                 return -1;
             }
 
-            flags = paramDescriptor->isMutable ? PyBUF_WRITABLE : PyBUF_SIMPLE;
-            if (PyObject_GetBuffer(pyArg, pyBuffer, flags) < 0) {
-                PyMem_Del(pyBuffer);
-                return -1;
+            // Reuse the buffer acquired by overload matching, if any
+            if (!JType_TakeArgBuffer(pyArg, paramDescriptor->isMutable, pyBuffer)) {
+                flags = paramDescriptor->isMutable ? PyBUF_WRITABLE : PyBUF_SIMPLE;
+                if (PyObject_GetBuffer(pyArg, pyBuffer, flags) < 0) {
+                    PyMem_Del(pyBuffer);
+                    return -1;
+                }
             }
 
             itemCount = pyBuffer->len / pyBuffer->itemsize;
@@ -1919,15 +3348,16 @@ PyObject* JType_str(JPy_JType* self)
  */
 void JType_dealloc(JPy_JType* self)
 {
-    JNIEnv* jenv = JPy_GetJNIEnv();
+    JNIEnv* jenv = JPy_GetReleaseJNIEnv();
+    int i;
 
     //printf("JType_dealloc: self->javaName='%s', self->classRef=%p\n", self->javaName, self->classRef);
 
     PyMem_Del(self->javaName);
     self->javaName = NULL;
 
-    if (jenv != NULL && self->classRef != NULL) {
-        (*jenv)->DeleteGlobalRef(jenv, self->classRef);
+    if (self->classRef != NULL) {
+        JPy_DeleteGlobalRef(jenv, self->classRef);
         self->classRef = NULL;
     }
 
@@ -1937,6 +3367,13 @@ void JType_dealloc(JPy_JType* self)
     Py_XDECREF(self->componentType);
     self->componentType = NULL;
 
+    for (i = 0; i < self->assignableTypeCount; i++) {
+        Py_DECREF(self->assignableTypes[i]);
+    }
+    PyMem_Del(self->assignableTypes);
+    self->assignableTypes = NULL;
+    self->assignableTypeCount = 0;
+
     Py_TYPE(self)->tp_free((PyObject*) self);
 }
 
@@ -1950,7 +3387,9 @@ PyObject* JType_getattro(JPy_JType* self, PyObject* name)
     if (!self->isResolved && !self->isResolving) {
         JNIEnv* jenv;
         JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL);
+        JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
         JType_ResolveType(jenv, self);
+        JPy_END_LOCAL_FRAME(jenv)
     }
 
     return PyObject_GenericGetAttr((PyObject*) self, name);
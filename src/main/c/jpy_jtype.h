@@ -40,6 +40,14 @@ typedef struct JPy_JType
     struct JPy_JType* superType;
     // If component type of this type if this type is an array, NULL otherwise.
     struct JPy_JType* componentType;
+    // The super classes of this type and all interfaces implemented by them (new references), used to test
+    // assignability without calling into the JVM. NULL until first used, see JType_IsAssignableTo().
+    struct JPy_JType** assignableTypes;
+    // Number of entries in assignableTypes.
+    int assignableTypeCount;
+    // Incremented whenever a method overload is added to one of the type's overloaded methods, so that the dispatch
+    // tables of this type's and derived types' overloaded methods are rebuilt, see JOverloadedMethod_AddMethod().
+    int methodGeneration;
     // If TRUE, 'classRef' refers to a Java primitive type or 'void'.
     char isPrimitive;
     // If TRUE, 'classRef' refers to a Java interface type.
@@ -113,6 +121,7 @@ int JType_Check(PyObject* obj);
 JPy_JType* JType_GetTypeForObject(JNIEnv* jenv, jobject objectRef);
 JPy_JType* JType_GetTypeForName(JNIEnv* jenv, const char* typeName, jboolean resolve);
 JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve);
+void       JType_ClearTypeCache(void);
 
 PyObject* JType_ConvertJavaToPythonObject(JNIEnv* jenv, JPy_JType* type, jobject objectRef);
 int       JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* arg, jobject* objectRef);
@@ -120,13 +129,23 @@ int       JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObjec
 PyObject* JType_GetOverloadedMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodName, jboolean useSuperClass);
 
 int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg);
+int JType_MatchPyArgAsJObjectParam(JNIEnv* jenv, JPy_ParamDescriptor* paramDescriptor, PyObject* pyArg);
+int JType_IsTypeStableMatch(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyArg);
+int JType_IsAssignableTo(JNIEnv* jenv, JPy_JType* type, JPy_JType* otherType);
+void JType_ReleaseArgBuffer(void);
 
 int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyArg, jobject* objectRef);
+char JType_GetBufferFormatChar(const Py_buffer* view);
 
 // Non-API. Defined in jpy_jobj.c
 int JType_InitSlots(JPy_JType* type);
 // Non-API. Defined in jpy_jtype.c
 int JType_ResolveType(JNIEnv* jenv, JPy_JType* type);
+int JType_ResolveMembers(JNIEnv* jenv, JPy_JType* type, jboolean resolveMemberTypes);
+int JType_ProcessReflectedMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, jobject memberRef, jboolean isStatic, jboolean isConstructor);
+int JType_ProcessMethodSignature(JNIEnv* jenv, JPy_JType* type, PyObject* methodKey, PyObject* signature, jboolean isStatic, jboolean isConstructor, jmethodID mid);
+PyObject* JType_GetMemberMetadata(JNIEnv* jenv, JPy_JType* type);
+int JType_AddFieldAttribute(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldName, JPy_JType* fieldType, jfieldID fid);
 
 int JType_AddClassAttribute(JNIEnv* jenv, JPy_JType* type);
 
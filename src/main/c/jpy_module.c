@@ -20,12 +20,15 @@
 #include "jpy_jmethod.h"
 #include "jpy_jfield.h"
 #include "jpy_jobj.h"
+#include "jpy_jarray.h"
+#include "jpy_jbuffer.h"
 #include "jpy_conv.h"
 #include "jpy_compat.h"
 
 
 #include <stdlib.h>
 #include <string.h>
+#include <pythread.h>
 
 
 PyObject* JPy_has_jvm(PyObject* self);
@@ -34,6 +37,12 @@ PyObject* JPy_destroy_jvm(PyObject* self, PyObject* args);
 PyObject* JPy_get_type(PyObject* self, PyObject* args, PyObject* kwds);
 PyObject* JPy_cast(PyObject* self, PyObject* args);
 PyObject* JPy_array(PyObject* self, PyObject* args);
+PyObject* JPy_set_release_gil(PyObject* self, PyObject* args);
+PyObject* JPy_critical_view(PyObject* self, PyObject* args);
+PyObject* JPy_direct_buffer(PyObject* self, PyObject* args);
+PyObject* JPy_get_type_metadata(PyObject* self, PyObject* noargs);
+PyObject* JPy_set_type_metadata(PyObject* self, PyObject* args);
+PyObject* JPy_preload(PyObject* self, PyObject* args, PyObject* kwds);
 
 
 static PyMethodDef JPy_Functions[] = {
@@ -59,6 +68,32 @@ static PyMethodDef JPy_Functions[] = {
                     "array(name, init) - Return a new Java array of given Java type (type name or type object) and initializer (array length or sequence). "
                     "Possible primitive types are 'boolean', 'byte', 'char', 'short', 'int', 'long', 'float', and 'double'."},
 
+    {"set_release_gil", JPy_set_release_gil, METH_VARARGS,
+                    "set_release_gil(value) - Set whether the Python GIL is released while any Java method is executing. "
+                    "Single methods may also be configured using their 'release_gil' attribute. Returns the previous setting."},
+
+    {"critical_view", JPy_critical_view, METH_VARARGS,
+                    "critical_view(array) - Return a writable memoryview that directly accesses the elements of the given Java primitive array "
+                    "without copying them. Java cannot be accessed until the view is released, so use it as a context manager: "
+                    "'with jpy.critical_view(a) as m: ...'."},
+
+    {"direct_buffer", JPy_direct_buffer, METH_VARARGS,
+                    "direct_buffer(obj) - Return a new direct 'java.nio.ByteBuffer' that accesses the memory of the given contiguous Python buffer object "
+                    "without copying it. The buffer object must be kept alive while Java uses the ByteBuffer."},
+
+    {"get_type_metadata", (PyCFunction) JPy_get_type_metadata, METH_NOARGS,
+                    "get_type_metadata() - Return a dictionary that maps the names of all resolved Java types to (declared_count, members) "
+                    "tuples, where members is a list of (name, modifiers, signature) tuples describing their public constructors, methods and fields."},
+
+    {"set_type_metadata", JPy_set_type_metadata, METH_VARARGS,
+                    "set_type_metadata(metadata) - Set the type metadata, as returned by get_type_metadata(), which is used to look up "
+                    "the members of Java types instead of reflecting them. Pass None to clear it."},
+
+    {"preload",     (PyCFunction) JPy_preload, METH_VARARGS|METH_KEYWORDS,
+                    "preload(names, recursive=True) - Resolve the Java types of the given names and prepare all their members for use. "
+                    "If recursive is True, the types of the members' parameters, return values and fields are resolved too. "
+                    "The classes are loaded and reflected on Java worker threads without holding the Python GIL."},
+
     {NULL, NULL, 0, NULL} /*Sentinel*/
 };
 
@@ -93,6 +128,37 @@ JavaVM* JPy_JVM = NULL;
 // If true, this JVM structure has been initialised from Python jpy.create_jvm()
 jboolean JPy_MustDestroyJVM = JNI_FALSE;
 
+// If true, the Python GIL is released while Java methods are executing, see jpy.set_release_gil()
+jboolean JPy_ReleaseGIL = JNI_FALSE;
+
+// The number of currently exported critical array views, see jpy.critical_view()
+int JPy_CriticalBufferCount = 0;
+
+/**
+ * A JNI call deferred while a critical array view was in use or while the current thread had no JNI environment,
+ * see JPy_DeleteGlobalRef() and JPy_ReleaseArrayElements().
+ */
+typedef struct
+{
+    // The global reference to be deleted, or the array whose elements are to be released.
+    jobject globalRef;
+    // The array elements to be released, NULL if the global reference is to be deleted.
+    void* elements;
+    // The array's primitive element type, e.g. 'I' for int.
+    char javaType;
+}
+JPy_DeferredRelease;
+
+static JPy_DeferredRelease* JPy_DeferredReleases = NULL;
+static int JPy_DeferredReleaseCount = 0;
+
+// Maps Java type names to (declaredCount, members) tuples, where members is a tuple of (name, modifiers, signature) tuples,
+// see jpy.set_type_metadata()
+PyObject* JPy_TypeMetadata = NULL;
+
+// Like JPy_TypeMetadata, but only set while jpy.preload() creates the types reflected by org.jpy.TypeReflector
+PyObject* JPy_PreloadMetadata = NULL;
+
 
 // Global VM Information (maybe better place this in the JPy_JVM structure later)
 // {{{
@@ -119,6 +185,7 @@ JPy_JType* JPy_JClass = NULL;
 JPy_JType* JPy_JString = NULL;
 JPy_JType* JPy_JPyObject = NULL;
 JPy_JType* JPy_JPyModule = NULL;
+JPy_JType* JPy_JTypeReflector = NULL;
 
 
 // java.lang.Comparable
@@ -142,6 +209,7 @@ jmethodID JPy_Class_GetMethods_MID = NULL;
 jmethodID JPy_Class_GetComponentType_MID = NULL;
 jmethodID JPy_Class_IsPrimitive_MID = NULL;
 jmethodID JPy_Class_IsInterface_MID = NULL;
+jmethodID JPy_Class_GetInterfaces_MID = NULL;
 
 // java.lang.reflect.Constructor
 jclass JPy_Constructor_JClass = NULL;
@@ -202,15 +270,94 @@ jclass JPy_String_JClass = NULL;
 jmethodID JPy_PyObject_GetPointer_MID = NULL;
 jmethodID JPy_PyObject_Init_MID = NULL;
 jmethodID JPy_PyModule_Init_MID = NULL;
+jmethodID JPy_TypeReflector_Reflect_MID = NULL;
 
 // }}}
 
 
+// The JNI environment of the current thread and the JVM it belongs to, see JPy_GetJNIEnv()
+static JPY_THREAD_LOCAL JNIEnv* JPy_ThreadJNIEnv = NULL;
+static JPY_THREAD_LOCAL JavaVM* JPy_ThreadJVM = NULL;
+// Whether the current thread has been detached by JPy_DetachThread(). Objects still cleared from its Python thread
+// state afterwards must not attach it again, the thread would stay attached after it exited.
+static JPY_THREAD_LOCAL jboolean JPy_ThreadDetached = JNI_FALSE;
+
+#define JPy_THREAD_DETACH_KEY "jpy.thread_detach"
+
+typedef struct
+{
+    JavaVM* jvm;
+    unsigned long threadId;
+}
+JPy_ThreadDetach;
+
+/**
+ * Destructor of the capsule stored in the Python thread state's dictionary of threads attached by JPy_GetJNIEnv0().
+ * Called when the thread state is cleared.
+ */
+static void JPy_DetachThread(PyObject* capsule)
+{
+    JPy_ThreadDetach* detach;
+
+    detach = (JPy_ThreadDetach*) PyCapsule_GetPointer(capsule, JPy_THREAD_DETACH_KEY);
+    if (detach == NULL) {
+        PyErr_Clear();
+        return;
+    }
+
+    // Thread states may also be cleared by other threads, e.g. during interpreter shutdown
+    if (detach->jvm == JPy_JVM && detach->threadId == (unsigned long) PyThread_get_thread_ident()) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_JVM, "JPy_DetachThread: Detaching current thread from JVM: jenv=%p\n", JPy_ThreadJNIEnv);
+        (*detach->jvm)->DetachCurrentThread(detach->jvm);
+        JPy_ThreadJNIEnv = NULL;
+        JPy_ThreadJVM = NULL;
+        JPy_ThreadDetached = JNI_TRUE;
+    }
+
+    PyMem_Del(detach);
+}
+
+/**
+ * Makes sure the current thread will be detached from the given JVM once its Python thread state is cleared.
+ */
+static void JPy_RegisterThreadDetach(JavaVM* jvm)
+{
+    PyObject* dict;
+    PyObject* capsule;
+    JPy_ThreadDetach* detach;
+
+    dict = PyThreadState_GetDict();
+    if (dict == NULL) {
+        // No Python thread state, the thread stays attached
+        return;
+    }
+
+    detach = PyMem_New(JPy_ThreadDetach, 1);
+    if (detach == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    detach->jvm = jvm;
+    detach->threadId = (unsigned long) PyThread_get_thread_ident();
+
+    capsule = PyCapsule_New(detach, JPy_THREAD_DETACH_KEY, JPy_DetachThread);
+    if (capsule == NULL) {
+        PyMem_Del(detach);
+        PyErr_Clear();
+        return;
+    }
+    if (PyDict_SetItemString(dict, JPy_THREAD_DETACH_KEY, capsule) < 0) {
+        PyErr_Clear();
+    }
+    Py_DECREF(capsule);
+}
+
+static JNIEnv* JPy_GetJNIEnv0(JavaVM* jvm);
+
 JNIEnv* JPy_GetJNIEnv(void)
 {
     JavaVM* jvm;
     JNIEnv* jenv;
-    jint status;
 
     jvm = JPy_JVM;
     if (jvm == NULL) {
@@ -218,10 +365,45 @@ JNIEnv* JPy_GetJNIEnv(void)
         return NULL;
     }
 
+    if (JPy_ThreadJVM == jvm) {
+        jenv = JPy_ThreadJNIEnv;
+    } else if (JPy_ThreadDetached) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy: The current thread is exiting and has been detached from the JVM.");
+        return NULL;
+    } else {
+        jenv = JPy_GetJNIEnv0(jvm);
+        if (jenv == NULL) {
+            return NULL;
+        }
+        JPy_ThreadJNIEnv = jenv;
+        JPy_ThreadJVM = jvm;
+    }
+
+    if (JPy_DeferredReleases != NULL) {
+        // Releases deferred by threads without a JNI environment
+        JPy_ReleaseDeferred(jenv);
+    }
+    return jenv;
+}
+
+JNIEnv* JPy_GetReleaseJNIEnv(void)
+{
+    if (JPy_JVM != NULL && JPy_ThreadJVM == JPy_JVM) {
+        return JPy_ThreadJNIEnv;
+    }
+    return NULL;
+}
+
+static JNIEnv* JPy_GetJNIEnv0(JavaVM* jvm)
+{
+    JNIEnv* jenv;
+    jint status;
+
     status = (*jvm)->GetEnv(jvm, (void**) &jenv, JPY_JNI_VERSION);
     if (status == JNI_EDETACHED) {
         if ((*jvm)->AttachCurrentThread(jvm, (void**) &jenv, NULL) == 0) {
             JPy_DIAG_PRINT(JPy_DIAG_F_JVM, "JPy_GetJNIEnv: Attached current thread to JVM: jenv=%p\n", jenv);
+            JPy_RegisterThreadDetach(jvm);
         } else {
             PyErr_SetString(PyExc_RuntimeError, "jpy: Failed to attach current thread to JVM.");
             return NULL;
@@ -234,11 +416,134 @@ JNIEnv* JPy_GetJNIEnv(void)
         JPy_DIAG_PRINT(JPy_DIAG_F_JVM, "JPy_GetJNIEnv: jenv=%p\n", jenv);
     } else {
         JPy_DIAG_PRINT(JPy_DIAG_F_JVM + JPy_DIAG_F_ERR, "JPy_GetJNIEnv: Received unhandled status code from JVM GetEnv(): status=%d\n", status);
+        PyErr_SetString(PyExc_RuntimeError, "jpy: Failed to get the JNI environment of the current thread.");
+        return NULL;
     }
 
     return jenv;
 }
 
+int JPy_PushLocalFrame(JNIEnv* jenv)
+{
+    if ((*jenv)->PushLocalFrame(jenv, JPy_LOCAL_FRAME_CAPACITY) < 0) {
+        JPy_HandleJavaException(jenv);
+        return -1;
+    }
+    JPy_DiagLocalFrameCount++;
+    return 0;
+}
+
+/**
+ * Defers the given release until the critical array view in use is released. Returns 0 on success, -1 if there
+ * is not enough memory.
+ */
+static int JPy_DeferRelease(jobject globalRef, void* elements, char javaType)
+{
+    JPy_DeferredRelease* deferredReleases;
+
+    deferredReleases = JPy_DeferredReleases;
+    PyMem_Resize(deferredReleases, JPy_DeferredRelease, JPy_DeferredReleaseCount + 1);
+    if (deferredReleases == NULL) {
+        return -1;
+    }
+    deferredReleases[JPy_DeferredReleaseCount].globalRef = globalRef;
+    deferredReleases[JPy_DeferredReleaseCount].elements = elements;
+    deferredReleases[JPy_DeferredReleaseCount].javaType = javaType;
+    JPy_DeferredReleaseCount++;
+    JPy_DeferredReleases = deferredReleases;
+    return 0;
+}
+
+static void JPy_ReleaseArrayElements0(JNIEnv* jenv, jarray arrayRef, void* elements, char javaType)
+{
+    if (javaType == 'Z') {
+        (*jenv)->ReleaseBooleanArrayElements(jenv, arrayRef, (jboolean*) elements, 0);
+    } else if (javaType == 'C') {
+        (*jenv)->ReleaseCharArrayElements(jenv, arrayRef, (jchar*) elements, 0);
+    } else if (javaType == 'B') {
+        (*jenv)->ReleaseByteArrayElements(jenv, arrayRef, (jbyte*) elements, 0);
+    } else if (javaType == 'S') {
+        (*jenv)->ReleaseShortArrayElements(jenv, arrayRef, (jshort*) elements, 0);
+    } else if (javaType == 'I') {
+        (*jenv)->ReleaseIntArrayElements(jenv, arrayRef, (jint*) elements, 0);
+    } else if (javaType == 'J') {
+        (*jenv)->ReleaseLongArrayElements(jenv, arrayRef, (jlong*) elements, 0);
+    } else if (javaType == 'F') {
+        (*jenv)->ReleaseFloatArrayElements(jenv, arrayRef, (jfloat*) elements, 0);
+    } else if (javaType == 'D') {
+        (*jenv)->ReleaseDoubleArrayElements(jenv, arrayRef, (jdouble*) elements, 0);
+    }
+}
+
+void JPy_DeleteGlobalRef(JNIEnv* jenv, jobject globalRef)
+{
+    if (JPy_JVM == NULL) {
+        // The reference died with the JVM
+        return;
+    }
+    if (jenv != NULL && JPy_CriticalBufferCount == 0) {
+        // Keeps the order of releases, array elements must be released before the array's global reference is deleted
+        JPy_ReleaseDeferred(jenv);
+        (*jenv)->DeleteGlobalRef(jenv, globalRef);
+        return;
+    }
+
+    if (JPy_DeferRelease(globalRef, NULL, 0) < 0) {
+        // The reference is leaked, which is still better than calling into the JVM within a critical region
+        // or attaching an exiting thread
+        JPy_DIAG_PRINT(JPy_DIAG_F_MEM + JPy_DIAG_F_ERR, "JPy_DeleteGlobalRef: out of memory, leaking globalRef=%p\n", globalRef);
+        return;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JPy_DeleteGlobalRef: deferred deletion of globalRef=%p\n", globalRef);
+}
+
+void JPy_ReleaseArrayElements(JNIEnv* jenv, jarray arrayRef, void* elements, char javaType)
+{
+    if (JPy_JVM == NULL) {
+        return;
+    }
+    if (jenv != NULL && JPy_CriticalBufferCount == 0) {
+        JPy_ReleaseDeferred(jenv);
+        JPy_ReleaseArrayElements0(jenv, arrayRef, elements, javaType);
+        return;
+    }
+
+    if (JPy_DeferRelease(arrayRef, elements, javaType) < 0) {
+        // The elements are leaked and not written back, which is still better than calling into the JVM within a critical region
+        JPy_DIAG_PRINT(JPy_DIAG_F_MEM + JPy_DIAG_F_ERR, "JPy_ReleaseArrayElements: out of memory, leaking elements=%p\n", elements);
+        return;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JPy_ReleaseArrayElements: deferred release of elements=%p\n", elements);
+}
+
+void JPy_ReleaseDeferred(JNIEnv* jenv)
+{
+    JPy_DeferredRelease* deferredReleases;
+    int deferredReleaseCount;
+    int i;
+
+    if (JPy_CriticalBufferCount > 0 || JPy_DeferredReleases == NULL) {
+        return;
+    }
+
+    deferredReleases = JPy_DeferredReleases;
+    deferredReleaseCount = JPy_DeferredReleaseCount;
+    JPy_DeferredReleases = NULL;
+    JPy_DeferredReleaseCount = 0;
+
+    // In the order of deferral, so that array elements are released before the array's global reference is deleted
+    for (i = 0; i < deferredReleaseCount; i++) {
+        if (deferredReleases[i].elements != NULL) {
+            JPy_ReleaseArrayElements0(jenv, deferredReleases[i].globalRef, deferredReleases[i].elements, deferredReleases[i].javaType);
+        } else {
+            (*jenv)->DeleteGlobalRef(jenv, deferredReleases[i].globalRef);
+        }
+    }
+    PyMem_Del(deferredReleases);
+}
+
 #if defined(JPY_COMPAT_33P)
 #define JPY_RETURN(V) return V
 #define JPY_MODULE_INIT_FUNC PyInit_jpy
@@ -467,6 +772,8 @@ PyObject* JPy_get_type(PyObject* self, PyObject* args, PyObject* kwds)
     const char* className;
     int resolve;
 
+    JPy_JType* type;
+
     JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
 
     resolve = 1; // True
@@ -474,16 +781,433 @@ PyObject* JPy_get_type(PyObject* self, PyObject* args, PyObject* kwds)
         return NULL;
     }
 
-    return (PyObject*) JType_GetTypeForName(jenv, className, (jboolean) (resolve != 0 ? JNI_TRUE : JNI_FALSE));
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    type = JType_GetTypeForName(jenv, className, (jboolean) (resolve != 0 ? JNI_TRUE : JNI_FALSE));
+    JPy_END_LOCAL_FRAME(jenv)
+    return (PyObject*) type;
+}
+
+PyObject* JPy_set_release_gil(PyObject* self, PyObject* args)
+{
+    jboolean oldValue;
+    int value;
+
+#if defined(JPY_COMPAT_33P)
+    if (!PyArg_ParseTuple(args, "p:set_release_gil", &value)) {
+#elif defined(JPY_COMPAT_27)
+    if (!PyArg_ParseTuple(args, "i:set_release_gil", &value)) {
+#else
+#error JPY_VERSION_ERROR
+#endif
+        return NULL;
+    }
+
+    oldValue = JPy_ReleaseGIL;
+    JPy_ReleaseGIL = value ? JNI_TRUE : JNI_FALSE;
+    return PyBool_FromLong(oldValue);
+}
+
+PyObject* JPy_critical_view(PyObject* self, PyObject* args)
+{
+    PyObject* obj;
+    JPy_JType* type;
+
+    if (!PyArg_ParseTuple(args, "O:critical_view", &obj)) {
+        return NULL;
+    }
+
+    if (JPy_JVM == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy: No JVM available.");
+        return NULL;
+    }
+
+    type = JObj_Check(obj) ? (JPy_JType*) Py_TYPE(obj) : NULL;
+    if (type == NULL || type->componentType == NULL || !type->componentType->isPrimitive) {
+        PyErr_SetString(PyExc_ValueError, "critical_view: argument 1 (array) must be a Java primitive array");
+        return NULL;
+    }
+
+    return JArray_NewCriticalView((JPy_JArray*) obj);
 }
 
+PyObject* JPy_direct_buffer(PyObject* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    PyObject* obj;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (!PyArg_ParseTuple(args, "O:direct_buffer", &obj)) {
+        return NULL;
+    }
+
+    return JBuffer_NewDirectBuffer(jenv, obj);
+}
+
+PyObject* JPy_get_type_metadata(PyObject* self, PyObject* noargs)
+{
+    JNIEnv* jenv;
+    PyObject* metadata;
+    PyObject* key;
+    PyObject* value;
+    PyObject* members;
+    JPy_JType* type;
+    Py_ssize_t pos;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    metadata = PyDict_New();
+    if (metadata == NULL) {
+        return NULL;
+    }
+
+    pos = 0;
+    while (PyDict_Next(JPy_Types, &pos, &key, &value)) {
+        type = (JPy_JType*) value;
+        if (!JType_Check(value) || !type->isResolved || type->isPrimitive) {
+            continue;
+        }
+        members = JType_GetMemberMetadata(jenv, type);
+        if (members == NULL || PyDict_SetItemString(metadata, type->javaName, members) < 0) {
+            Py_XDECREF(members);
+            Py_DECREF(metadata);
+            return NULL;
+        }
+        Py_DECREF(members);
+    }
+
+    return metadata;
+}
+
+/**
+ * Converts the member metadata of a single Java type into a tuple of (name, modifiers, signature) tuples.
+ */
+PyObject* JPy_ParseMemberMetadata(PyObject* members)
+{
+    PyObject* memberSeq;
+    PyObject* memberTuple;
+    PyObject* memberItem;
+    PyObject* result;
+    const char* name;
+    const char* signature;
+    int modifiers;
+    Py_ssize_t memberCount;
+    Py_ssize_t i;
+
+    memberSeq = PySequence_Fast(members, "set_type_metadata: members must be given as a sequence of (name, modifiers, signature) tuples");
+    if (memberSeq == NULL) {
+        return NULL;
+    }
+
+    memberCount = PySequence_Fast_GET_SIZE(memberSeq);
+    result = PyTuple_New(memberCount);
+    for (i = 0; i < memberCount && result != NULL; i++) {
+        memberTuple = PySequence_Tuple(PySequence_Fast_GET_ITEM(memberSeq, i));
+        if (memberTuple == NULL || !PyArg_ParseTuple(memberTuple, "sis:set_type_metadata", &name, &modifiers, &signature)) {
+            memberItem = NULL;
+        } else {
+            memberItem = Py_BuildValue("(NiN)", JPy_INTERN_CSTR(name), modifiers, JPy_FROM_CSTR(signature));
+        }
+        Py_XDECREF(memberTuple);
+        if (memberItem == NULL) {
+            Py_DECREF(result);
+            result = NULL;
+        } else {
+            PyTuple_SET_ITEM(result, i, memberItem);
+        }
+    }
+
+    Py_DECREF(memberSeq);
+    return result;
+}
+
+/**
+ * Converts the (declared_count, members) metadata of a single Java type into a (declaredCount, members) tuple,
+ * where members is a tuple of (name, modifiers, signature) tuples.
+ */
+PyObject* JPy_ParseTypeMetadata(PyObject* typeMetadata)
+{
+    PyObject* typeTuple;
+    PyObject* members;
+    PyObject* result;
+    long declaredCount;
+
+    typeTuple = PySequence_Tuple(typeMetadata);
+    if (typeTuple == NULL || !PyArg_ParseTuple(typeTuple, "lO:set_type_metadata", &declaredCount, &members)) {
+        Py_XDECREF(typeTuple);
+        return NULL;
+    }
+
+    members = JPy_ParseMemberMetadata(members);
+    result = members != NULL ? Py_BuildValue("(lN)", declaredCount, members) : NULL;
+    Py_DECREF(typeTuple);
+    return result;
+}
+
+PyObject* JPy_set_type_metadata(PyObject* self, PyObject* args)
+{
+    PyObject* metadata;
+    PyObject* newMetadata;
+    PyObject* key;
+    PyObject* value;
+    PyObject* typeMetadata;
+    Py_ssize_t pos;
+
+    if (!PyArg_ParseTuple(args, "O:set_type_metadata", &metadata)) {
+        return NULL;
+    }
+
+    if (metadata == Py_None) {
+        newMetadata = NULL;
+    } else if (PyDict_Check(metadata)) {
+        newMetadata = PyDict_New();
+        if (newMetadata == NULL) {
+            return NULL;
+        }
+        pos = 0;
+        while (PyDict_Next(metadata, &pos, &key, &value)) {
+            if (!JPy_IS_STR(key)) {
+                PyErr_SetString(PyExc_ValueError, "set_type_metadata: keys of argument 1 (metadata) must be Java type names");
+                Py_DECREF(newMetadata);
+                return NULL;
+            }
+            typeMetadata = JPy_ParseTypeMetadata(value);
+            if (typeMetadata == NULL || PyDict_SetItem(newMetadata, key, typeMetadata) < 0) {
+                Py_XDECREF(typeMetadata);
+                Py_DECREF(newMetadata);
+                return NULL;
+            }
+            Py_DECREF(typeMetadata);
+        }
+    } else {
+        PyErr_SetString(PyExc_ValueError, "set_type_metadata: argument 1 (metadata) must be a dictionary or None");
+        return NULL;
+    }
+
+    Py_XDECREF(JPy_TypeMetadata);
+    JPy_TypeMetadata = newMetadata;
+    return Py_BuildValue("");
+}
+
+/**
+ * Converts the (name, modifiers, signature) triples of a class reflected by org.jpy.TypeReflector.reflect()
+ * into a tuple of (name, modifiers, signature) tuples, as used by JPy_TypeMetadata.
+ */
+PyObject* JPy_NewReflectedMembers(JNIEnv* jenv, jobjectArray memberStrs)
+{
+    PyObject* members;
+    PyObject* member;
+    jstring nameStr;
+    jstring modifiersStr;
+    jstring signatureStr;
+    const char* name;
+    const char* modifiers;
+    const char* signature;
+    jint memberCount;
+    jint j;
+
+    memberCount = (*jenv)->GetArrayLength(jenv, memberStrs) / 3;
+    members = PyTuple_New(memberCount);
+    for (j = 0; j < memberCount && members != NULL; j++) {
+        nameStr = (*jenv)->GetObjectArrayElement(jenv, memberStrs, 3 * j);
+        modifiersStr = (*jenv)->GetObjectArrayElement(jenv, memberStrs, 3 * j + 1);
+        signatureStr = (*jenv)->GetObjectArrayElement(jenv, memberStrs, 3 * j + 2);
+        name = (*jenv)->GetStringUTFChars(jenv, nameStr, NULL);
+        modifiers = (*jenv)->GetStringUTFChars(jenv, modifiersStr, NULL);
+        signature = (*jenv)->GetStringUTFChars(jenv, signatureStr, NULL);
+        if (name != NULL && modifiers != NULL && signature != NULL) {
+            member = Py_BuildValue("(NiN)", JPy_INTERN_CSTR(name), atoi(modifiers), JPy_FROM_CSTR(signature));
+        } else {
+            PyErr_NoMemory();
+            member = NULL;
+        }
+        if (signature != NULL) {
+            (*jenv)->ReleaseStringUTFChars(jenv, signatureStr, signature);
+        }
+        if (modifiers != NULL) {
+            (*jenv)->ReleaseStringUTFChars(jenv, modifiersStr, modifiers);
+        }
+        if (name != NULL) {
+            (*jenv)->ReleaseStringUTFChars(jenv, nameStr, name);
+        }
+        (*jenv)->DeleteLocalRef(jenv, signatureStr);
+        (*jenv)->DeleteLocalRef(jenv, modifiersStr);
+        (*jenv)->DeleteLocalRef(jenv, nameStr);
+        if (member == NULL) {
+            Py_DECREF(members);
+            members = NULL;
+        } else {
+            PyTuple_SET_ITEM(members, j, member);
+        }
+    }
+
+    return members;
+}
+
+/**
+ * Adds the type metadata returned by org.jpy.TypeReflector.reflect() to the given dictionary and resolves its types.
+ * The dictionary must be the current JPy_PreloadMetadata, so that the types are created from it.
+ */
+int JPy_AddReflectedTypes(JNIEnv* jenv, jobjectArray reflected, PyObject* metadata)
+{
+    PyObject* typeKey;
+    PyObject* typeMetadata;
+    PyObject* members;
+    jclass classRef;
+    jobjectArray memberStrs;
+    jint typeCount;
+    jint i;
+    int status;
+
+    typeCount = (*jenv)->GetArrayLength(jenv, reflected) / 2;
+    for (i = 0; i < typeCount; i++) {
+        classRef = (*jenv)->GetObjectArrayElement(jenv, reflected, 2 * i);
+        memberStrs = (*jenv)->GetObjectArrayElement(jenv, reflected, 2 * i + 1);
+
+        // The members have just been reflected, so their number isn't checked, see JType_ProcessClassMetadata()
+        members = JPy_NewReflectedMembers(jenv, memberStrs);
+        typeMetadata = members != NULL ? Py_BuildValue("(iN)", -1, members) : NULL;
+        typeKey = typeMetadata != NULL ? JPy_FromTypeName(jenv, classRef) : NULL;
+        status = typeKey != NULL ? PyDict_SetItem(metadata, typeKey, typeMetadata) : -1;
+        Py_XDECREF(typeKey);
+        Py_XDECREF(typeMetadata);
+        (*jenv)->DeleteLocalRef(jenv, memberStrs);
+        (*jenv)->DeleteLocalRef(jenv, classRef);
+        if (status < 0) {
+            return -1;
+        }
+    }
+
+    // Resolve the types not before all metadata has been added, because their super types are resolved first
+    for (i = 0; i < typeCount; i++) {
+        classRef = (*jenv)->GetObjectArrayElement(jenv, reflected, 2 * i);
+        status = JType_GetType(jenv, classRef, JNI_TRUE) != NULL ? 0 : -1;
+        (*jenv)->DeleteLocalRef(jenv, classRef);
+        if (status < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+PyObject* JPy_preload0(JNIEnv* jenv, PyObject* nameSeq, jboolean recursive)
+{
+    PyObject* pyName;
+    PyObject* metadata;
+    PyObject* oldMetadata;
+    JPy_JType* type;
+    jobjectArray classNames;
+    jobjectArray reflected;
+    jstring classNameStr;
+    Py_ssize_t nameCount;
+    Py_ssize_t i;
+    int status;
+
+    nameCount = PySequence_Fast_GET_SIZE(nameSeq);
+    for (i = 0; i < nameCount; i++) {
+        if (!JPy_IS_STR(PySequence_Fast_GET_ITEM(nameSeq, i))) {
+            PyErr_SetString(PyExc_ValueError, "preload: argument 1 (names) must be a Java type name or a sequence of Java type names");
+            return NULL;
+        }
+    }
+
+    if (JPy_TypeReflector_Reflect_MID != NULL) {
+        classNames = (*jenv)->NewObjectArray(jenv, (jsize) nameCount, JPy_String_JClass, NULL);
+        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+        for (i = 0; i < nameCount; i++) {
+            classNameStr = (*jenv)->NewStringUTF(jenv, JPy_AS_UTF8(PySequence_Fast_GET_ITEM(nameSeq, i)));
+            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+            (*jenv)->SetObjectArrayElement(jenv, classNames, (jsize) i, classNameStr);
+            (*jenv)->DeleteLocalRef(jenv, classNameStr);
+        }
+
+        // Load and reflect the classes on Java worker threads without holding the GIL, only the types are created with it
+        Py_BEGIN_ALLOW_THREADS
+        reflected = (*jenv)->CallStaticObjectMethod(jenv, JPy_JTypeReflector->classRef, JPy_TypeReflector_Reflect_MID, classNames, recursive);
+        Py_END_ALLOW_THREADS
+        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+
+        metadata = PyDict_New();
+        if (metadata == NULL) {
+            return NULL;
+        }
+        // The reflected metadata is only used while this call creates the types, it mustn't outlive the classes
+        oldMetadata = JPy_PreloadMetadata;
+        JPy_PreloadMetadata = metadata;
+        status = JPy_AddReflectedTypes(jenv, reflected, metadata);
+        for (i = 0; i < nameCount && status == 0; i++) {
+            pyName = PySequence_Fast_GET_ITEM(nameSeq, i);
+            type = JType_GetTypeForName(jenv, JPy_AS_UTF8(pyName), JNI_TRUE);
+            if (type == NULL || JType_ResolveMembers(jenv, type, recursive) < 0) {
+                status = -1;
+            }
+        }
+        JPy_PreloadMetadata = oldMetadata;
+        Py_DECREF(metadata);
+        return status == 0 ? Py_BuildValue("") : NULL;
+    }
+
+    for (i = 0; i < nameCount; i++) {
+        pyName = PySequence_Fast_GET_ITEM(nameSeq, i);
+        type = JType_GetTypeForName(jenv, JPy_AS_UTF8(pyName), JNI_TRUE);
+        if (type == NULL || JType_ResolveMembers(jenv, type, recursive) < 0) {
+            return NULL;
+        }
+    }
+
+    return Py_BuildValue("");
+}
+
+PyObject* JPy_preload(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    static char* keywords[] = {"names", "recursive", NULL};
+    JNIEnv* jenv;
+    PyObject* names;
+    PyObject* nameSeq;
+    PyObject* result;
+    int recursive = 1;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+#if defined(JPY_COMPAT_33P)
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|p:preload", keywords, &names, &recursive)) {
+#elif defined(JPY_COMPAT_27)
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|i:preload", keywords, &names, &recursive)) {
+#else
+#error JPY_VERSION_ERROR
+#endif
+        return NULL;
+    }
+
+    if (JPy_IS_STR(names)) {
+        nameSeq = PyTuple_Pack(1, names);
+    } else {
+        nameSeq = PySequence_Fast(names, "preload: argument 1 (names) must be a Java type name or a sequence of Java type names");
+    }
+    if (nameSeq == NULL) {
+        return NULL;
+    }
+
+    if (JPy_PushLocalFrame(jenv) < 0) {
+        Py_DECREF(nameSeq);
+        return NULL;
+    }
+    result = JPy_preload0(jenv, nameSeq, recursive ? JNI_TRUE : JNI_FALSE);
+    JPy_END_LOCAL_FRAME(jenv)
+
+    Py_DECREF(nameSeq);
+    return result;
+}
+
+PyObject* JPy_cast0(JNIEnv* jenv, PyObject* obj, PyObject* objType);
+
 PyObject* JPy_cast(PyObject* self, PyObject* args)
 {
     JNIEnv* jenv;
     PyObject* obj;
     PyObject* objType;
-    JPy_JType* type;
-    jboolean inst;
+    PyObject* result;
 
     JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
 
@@ -500,6 +1224,17 @@ PyObject* JPy_cast(PyObject* self, PyObject* args)
         return NULL;
     }
 
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    result = JPy_cast0(jenv, obj, objType);
+    JPy_END_LOCAL_FRAME(jenv)
+    return result;
+}
+
+PyObject* JPy_cast0(JNIEnv* jenv, PyObject* obj, PyObject* objType)
+{
+    JPy_JType* type;
+    jboolean inst;
+
     if (JPy_IS_STR(objType)) {
         const char* typeName = JPy_AS_UTF8(objType);
         type = JType_GetTypeForName(jenv, typeName, JNI_FALSE);
@@ -515,22 +1250,33 @@ PyObject* JPy_cast(PyObject* self, PyObject* args)
 
     inst = (*jenv)->IsInstanceOf(jenv, ((JPy_JObj*) obj)->objectRef, type->classRef);
     if (inst) {
-        return (PyObject*) JObj_FromType(jenv, (JPy_JType*) objType, ((JPy_JObj*) obj)->objectRef);
+        return (PyObject*) JObj_FromType(jenv, type, ((JPy_JObj*) obj)->objectRef);
     } else {
         return Py_BuildValue("");
     }
 }
 
+PyObject* JPy_array0(JNIEnv* jenv, PyObject* args);
+
 PyObject* JPy_array(PyObject* self, PyObject* args)
 {
     JNIEnv* jenv;
+    PyObject* returnValue;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    JPy_BEGIN_LOCAL_FRAME(jenv, NULL)
+    returnValue = JPy_array0(jenv, args);
+    JPy_END_LOCAL_FRAME(jenv)
+    return returnValue;
+}
+
+PyObject* JPy_array0(JNIEnv* jenv, PyObject* args)
+{
     JPy_JType* componentType;
     jarray arrayRef;
     PyObject* objType;
     PyObject* objInit;
 
-    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
-
     if (!PyArg_ParseTuple(args, "OO:array", &objType, &objInit)) {
         return NULL;
     }
@@ -708,6 +1454,18 @@ int initGlobalPyObjectVars(JNIEnv* jenv)
         PyErr_Clear();
         return -1;
     }
+
+    JPy_JTypeReflector = JType_GetTypeForName(jenv, "org.jpy.TypeReflector", JNI_FALSE);
+    if (JPy_JTypeReflector == NULL) {
+        // org.jpy.TypeReflector may not be on the classpath, jpy.preload() reflects types itself then
+        PyErr_Clear();
+        return -1;
+    }
+    JPy_TypeReflector_Reflect_MID = (*jenv)->GetStaticMethodID(jenv, JPy_JTypeReflector->classRef, "reflect", "([Ljava/lang/String;Z)[Ljava/lang/Object;");
+    if (JPy_TypeReflector_Reflect_MID == NULL) {
+        (*jenv)->ExceptionClear(jenv);
+        return -1;
+    }
     return 0;
 }
 
@@ -736,6 +1494,7 @@ int JPy_InitGlobalVars(JNIEnv* jenv)
     DEFINE_METHOD(JPy_Class_GetComponentType_MID, JPy_Class_JClass, "getComponentType", "()Ljava/lang/Class;");
     DEFINE_METHOD(JPy_Class_IsPrimitive_MID, JPy_Class_JClass, "isPrimitive", "()Z");
     DEFINE_METHOD(JPy_Class_IsInterface_MID, JPy_Class_JClass, "isInterface", "()Z");
+    DEFINE_METHOD(JPy_Class_GetInterfaces_MID, JPy_Class_JClass, "getInterfaces", "()[Ljava/lang/Class;");
 
     DEFINE_CLASS(JPy_Constructor_JClass, "java/lang/reflect/Constructor");
     DEFINE_METHOD(JPy_Constructor_GetModifiers_MID, JPy_Constructor_JClass, "getModifiers", "()I");
@@ -829,6 +1588,8 @@ int JPy_InitGlobalVars(JNIEnv* jenv)
 
 void JPy_ClearGlobalVars(JNIEnv* jenv)
 {
+    JType_ClearTypeCache();
+
     if (jenv != NULL) {
         (*jenv)->DeleteGlobalRef(jenv, JPy_Comparable_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Object_JClass);
@@ -881,6 +1642,7 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
     JPy_Class_GetComponentType_MID = NULL;
     JPy_Class_IsPrimitive_MID = NULL;
     JPy_Class_IsInterface_MID = NULL;
+    JPy_Class_GetInterfaces_MID = NULL;
     JPy_Constructor_GetModifiers_MID = NULL;
     JPy_Constructor_GetParameterTypes_MID = NULL;
     JPy_Method_GetName_MID = NULL;
@@ -924,6 +1686,7 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
     Py_XDECREF(JPy_JDoubleObj);
     Py_XDECREF(JPy_JPyObject);
     Py_XDECREF(JPy_JPyModule);
+    Py_XDECREF(JPy_JTypeReflector);
 
     JPy_JBoolean = NULL;
     JPy_JChar = NULL;
@@ -945,6 +1708,8 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
     JPy_JDoubleObj = NULL;
     JPy_JPyObject = NULL;
     JPy_JPyModule = NULL;
+    JPy_JTypeReflector = NULL;
+    JPy_TypeReflector_Reflect_MID = NULL;
 }
 
 
@@ -988,6 +1753,8 @@ void JPy_free(void* unused)
     JPy_Types = NULL;
     JPy_Type_Callbacks = NULL;
     JException_Type = NULL;
+    Py_XDECREF(JPy_TypeMetadata);
+    JPy_TypeMetadata = NULL;
 
     JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "JPy_free: done freeing module data\n");
 }
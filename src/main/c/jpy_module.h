@@ -32,10 +32,14 @@ extern "C" {
 extern PyObject* JPy_Module;
 extern PyObject* JPy_Types;
 extern PyObject* JPy_Type_Callbacks;
+extern PyObject* JPy_TypeMetadata;
+extern PyObject* JPy_PreloadMetadata;
 extern PyObject* JException_Type;
 
 extern JavaVM* JPy_JVM;
 extern jboolean JPy_MustDestroyJVM;
+extern jboolean JPy_ReleaseGIL;
+extern int JPy_CriticalBufferCount;
 
 
 #define JPy_JTYPE_ATTR_NAME_JINIT "__jinit__"
@@ -47,12 +51,42 @@ extern jboolean JPy_MustDestroyJVM;
 /**
  * Gets the current JNI environment pointer.
  * Returns NULL, if the JVM is down.
+ * The pointer is cached per thread. Python threads attached to the JVM by this function are detached again
+ * when their Python thread state is cleared, i.e. when the thread exits. They are not attached again afterwards,
+ * so objects cleared from the thread state later on can't access Java anymore.
+ * Releases deferred by JPy_DeleteGlobalRef() and JPy_ReleaseArrayElements() are performed on the way.
  *
  * General jpy design guideline: Use the JPy_GetJNIEnv function only in entry points from Python calls into C.
  * Add a JNIEnv* as first parameter to all functions that require it.
  */
 JNIEnv* JPy_GetJNIEnv(void);
 
+/**
+ * Gets the JNI environment pointer of the current thread for releasing Java references, e.g. in tp_dealloc slots.
+ * Unlike JPy_GetJNIEnv(), it never attaches the thread to the JVM and never sets a Python exception.
+ * Returns NULL, if the JVM is down or the thread hasn't got a JNI environment (anymore).
+ */
+JNIEnv* JPy_GetReleaseJNIEnv(void);
+
+/**
+ * Deletes the given global reference. While a critical array view is in use, no JNI functions must be called,
+ * then the deletion is deferred until the view is released. If jenv is NULL, see JPy_GetReleaseJNIEnv(),
+ * the deletion is deferred to the next thread entering jpy. Must be used by all tp_dealloc slots.
+ */
+void JPy_DeleteGlobalRef(JNIEnv* jenv, jobject globalRef);
+/**
+ * Releases the array elements obtained by one of the Get<Type>ArrayElements() functions and writes them back.
+ * The Java type javaType is one of 'Z', 'C', 'B', 'S', 'I', 'J', 'F' and 'D'. While a critical array view is in use,
+ * the release is deferred until the view is released, the global array reference must be valid until then.
+ * If jenv is NULL, the release is deferred to the next thread entering jpy.
+ */
+void JPy_ReleaseArrayElements(JNIEnv* jenv, jarray arrayRef, void* elements, char javaType);
+/**
+ * Performs the releases deferred by JPy_DeleteGlobalRef() and JPy_ReleaseArrayElements().
+ * Does nothing while a critical array view is in use.
+ */
+void JPy_ReleaseDeferred(JNIEnv* jenv);
+
 int JPy_InitGlobalVars(JNIEnv* jenv);
 void JPy_ClearGlobalVars(JNIEnv* jenv);
 
@@ -64,11 +98,47 @@ void JPy_ClearGlobalVars(JNIEnv* jenv);
  * Add a JNIEnv* as first parameter to all functions that require it.
  */
 #define JPy_GET_JNI_ENV_OR_RETURN(JENV, RET_VALUE) \
-    if ((JENV = JPy_GetJNIEnv()) == NULL) { \
+    if (JPy_CriticalBufferCount > 0) { \
+        PyErr_SetString(PyExc_RuntimeError, "jpy: Java cannot be accessed while a critical array view is in use."); \
+        return (RET_VALUE); \
+    } else if ((JENV = JPy_GetJNIEnv()) == NULL) { \
+        return (RET_VALUE); \
+    } else { \
+    }
+
+
+/**
+ * The initial capacity of the local reference frames pushed by JPy_BEGIN_LOCAL_FRAME.
+ */
+#define JPy_LOCAL_FRAME_CAPACITY 16
+
+/**
+ * Pushes a new JNI local reference frame which must be popped by JPy_END_LOCAL_FRAME.
+ * Returns 0 on success. Otherwise a Python exception is set and -1 is returned.
+ * Only used directly where JPy_BEGIN_LOCAL_FRAME can't return immediately.
+ */
+int JPy_PushLocalFrame(JNIEnv* jenv);
+
+/**
+ * Pushes a new JNI local reference frame. Must be used after JPy_GET_JNI_ENV_OR_RETURN in entry points from Python
+ * calls into C that create local references, and must be followed by a matching JPy_END_LOCAL_FRAME.
+ * Python threads attached to the JVM never return to Java, so their local references are otherwise never released.
+ * Warning: This method may immediately return, so make sure there will be no memory leaks in this case.
+ */
+#define JPy_BEGIN_LOCAL_FRAME(JENV, RET_VALUE) \
+    if (JPy_PushLocalFrame(JENV) < 0) { \
         return (RET_VALUE); \
     } else { \
     }
 
+/**
+ * Pops the JNI local reference frame pushed by JPy_BEGIN_LOCAL_FRAME and releases all local references created since.
+ * Values returned to Python must not hold local references.
+ */
+#define JPy_END_LOCAL_FRAME(JENV) \
+    (*JENV)->PopLocalFrame(JENV, NULL); \
+    JPy_DiagLocalFrameCount--;
+
 
 /**
  * Fetches the last Java exception occurred and raises a new Python exception.
@@ -113,6 +183,7 @@ extern struct JPy_JType* JPy_JClass;
 extern struct JPy_JType* JPy_JString;
 extern struct JPy_JType* JPy_JPyObject;
 extern struct JPy_JType* JPy_JPyModule;
+extern struct JPy_JType* JPy_JTypeReflector;
 
 // java.lang.Comparable
 extern jclass JPy_Comparable_JClass;
@@ -133,6 +204,7 @@ extern jmethodID JPy_Class_GetMethods_MID;
 extern jmethodID JPy_Class_GetComponentType_MID;
 extern jmethodID JPy_Class_IsPrimitive_MID;
 extern jmethodID JPy_Class_IsInterface_MID;
+extern jmethodID JPy_Class_GetInterfaces_MID;
 // java.lang.reflect.Constructor
 extern jclass JPy_Constructor_JClass;
 extern jmethodID JPy_Constructor_GetModifiers_MID;
@@ -187,6 +259,7 @@ extern jclass JPy_Void_JClass;
 
 extern jmethodID JPy_PyObject_GetPointer_MID;
 extern jmethodID JPy_PyObject_Init_MID;
+extern jmethodID JPy_TypeReflector_Reflect_MID;
 
 #ifdef __cplusplus
 } /* extern "C" */
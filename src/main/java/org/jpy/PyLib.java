@@ -217,8 +217,34 @@ public class PyLib {
      * There is currently no workaround for that problem other than not restarting the Python interpreter from 
      * your code.
      * For more information refer to https://github.com/bcdev/jpy/issues/70
+     * <p>
+     * Stopping the interpreter disposes the native call plans of all Java proxies of Python objects, so it must
+     * not be called while other threads are still calling methods of such proxies.
+     */
+    public static void stopPython() {
+        PyProxyHandler.disposeCallPlans(null);
+        stopPython0();
+    }
+
+    /**
+     * Disposes the native call plans of the Java proxies of Python objects for the interfaces loaded by the given
+     * class loader. The plans are cached for all proxies of an interface and refer to its methods, so they keep the
+     * class loader alive. Call this method before dropping the class loader, e.g. when a plug-in is unloaded.
+     * Proxies of the interfaces may still be used afterwards, their plans are then created again.
+     * <p>
+     * Must not be called while other threads are calling methods of proxies of these interfaces.
+     *
+     * @param classLoader The class loader of the proxied interfaces.
+     * @since 0.9
      */
-    public static native void stopPython();
+    public static void disposeProxyCallPlans(ClassLoader classLoader) {
+        if (classLoader == null) {
+            throw new NullPointerException("classLoader");
+        }
+        PyProxyHandler.disposeCallPlans(classLoader);
+    }
+
+    static native void stopPython0();
 
     @Deprecated
     public static native int execScript(String script);
@@ -326,6 +352,85 @@ public class PyLib {
                                            Class<?>[] paramTypes,
                                            Class<T> returnType);
 
+    /**
+     * Gets the interned Python string object for the given attribute name.
+     * The returned handle can be passed to {@link #getInternedAttributeObject} and
+     * {@link #callInternedAndReturnObject} in order to avoid converting the same name on every call.
+     * <p>
+     * The handle is a new reference to a Python object which must be released using {@link #decRef(long)}.
+     * It becomes invalid once the Python interpreter is stopped.
+     *
+     * @param name The attribute name.
+     * @return The handle to the interned Python string.
+     */
+    static native long internName(String name);
+
+    /**
+     * Same as {@link #getAttributeObject(long, String)}, but uses a name handle obtained from {@link #internName}.
+     *
+     * @param pointer Identifies the Python object.
+     * @param name    The handle to the interned attribute name.
+     * @return The Python attribute value (always a new reference).
+     */
+    static native long getInternedAttributeObject(long pointer, long name);
+
+    /**
+     * Same as {@link #callAndReturnObject}, but uses a name handle obtained from {@link #internName}.
+     *
+     * @param pointer    Identifies the Python object which contains the callable {@code name}.
+     * @param methodCall true, if this is a call of a method of the Python object pointed to by {@code pointer}.
+     * @param name       The handle to the interned name of the callable.
+     * @param argCount   The argument count (length of the following {@code args} array).
+     * @param args       The arguments.
+     * @param paramTypes Optional array of parameter types for the conversion of the {@code args} into a Python tuple.
+     *                   If not null, it must be an array of the same length as {@code args}.
+     * @return The resulting Python object (always a new reference).
+     */
+    static native long callInternedAndReturnObject(long pointer,
+                                                   boolean methodCall,
+                                                   long name,
+                                                   int argCount,
+                                                   Object[] args,
+                                                   Class<?>[] paramTypes);
+
+    /**
+     * Creates a call plan for subsequent calls of the Python callable {@code name} using
+     * {@link #callPlanAndReturnValue}. The plan holds the interned Python name of the callable and the resolved
+     * parameter and return types, so that these are not looked up again on every call.
+     * <p>
+     * The plan must be disposed using {@link #disposeCallPlan} once it is no longer used, and at the latest
+     * before the Python interpreter is stopped.
+     *
+     * @param name       The name of the callable.
+     * @param paramTypes The parameter types used for the conversion of the arguments into a Python tuple.
+     * @param returnType Optional return type.
+     * @return A handle to the native call plan.
+     */
+    static native long createCallPlan(String name, Class<?>[] paramTypes, Class<?> returnType);
+
+    /**
+     * Disposes a call plan created by {@link #createCallPlan}.
+     *
+     * @param plan The handle to the native call plan.
+     */
+    static native void disposeCallPlan(long plan);
+
+    /**
+     * Calls a Python callable using a call plan and returns the a Java Object.
+     * Same as {@link #callAndReturnValue}, but uses the name, parameter types and return type
+     * given by the call plan.
+     *
+     * @param pointer    Identifies the Python object which contains the callable.
+     * @param methodCall true, if this is a call of a method of the Python object pointed to by {@code pointer}.
+     * @param plan       The handle to the native call plan, see {@link #createCallPlan}.
+     * @param args       The arguments, may be null if the callable takes no arguments.
+     * @return The resulting Java object.
+     */
+    static native <T> T callPlanAndReturnValue(long pointer,
+                                               boolean methodCall,
+                                               long plan,
+                                               Object[] args);
+
     private static void loadLib() {
         if (dllLoaded || dllProblem != null) {
             return;
@@ -18,7 +18,12 @@ package org.jpy;
 
 import java.lang.reflect.InvocationHandler;
 import java.lang.reflect.Method;
+import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
 
 import static org.jpy.PyLib.assertPythonRuns;
 
@@ -30,6 +35,16 @@ import static org.jpy.PyLib.assertPythonRuns;
  * @since 0.7
  */
 class PyProxyHandler implements InvocationHandler {
+    /**
+     * Native call plans of the interface methods invoked so far. Proxy classes share their {@code Method}
+     * instances, so plans are shared by all proxies of an interface. The plans are disposed when the
+     * Python interpreter is stopped, see {@link #disposeCallPlans(ClassLoader)}.
+     * <p>
+     * The {@code Method} keys pin their interfaces and thus the class loaders of the interfaces. Callers that
+     * unload interfaces must dispose their plans using {@link PyLib#disposeProxyCallPlans(ClassLoader)}.
+     */
+    private static final ConcurrentMap<Method, Long> callPlans = new ConcurrentHashMap<>();
+
     private final PyObject pyObject;
     private final PyLib.CallableKind callableKind;
 
@@ -53,12 +68,51 @@ class PyProxyHandler implements InvocationHandler {
                               Thread.currentThread());
         }
 
-        return PyLib.callAndReturnValue(this.pyObject.getPointer(),
-                                        callableKind == PyLib.CallableKind.METHOD,
-                                        method.getName(),
-                                        args != null ? args.length : 0,
-                                        args,
-                                        method.getParameterTypes(),
-                                        method.getReturnType());
+        return PyLib.callPlanAndReturnValue(this.pyObject.getPointer(),
+                                            callableKind == PyLib.CallableKind.METHOD,
+                                            getCallPlan(method),
+                                            args);
+    }
+
+    private static long getCallPlan(Method method) {
+        Long plan = callPlans.get(method);
+        if (plan == null) {
+            long newPlan = PyLib.createCallPlan(method.getName(), method.getParameterTypes(), method.getReturnType());
+            plan = callPlans.putIfAbsent(method, newPlan);
+            if (plan != null) {
+                PyLib.disposeCallPlan(newPlan);
+            } else {
+                plan = newPlan;
+            }
+        }
+        return plan;
+    }
+
+    /**
+     * Disposes the call plans of the methods of the interfaces loaded by the given class loader, or all call plans
+     * created so far if it is {@code null}. Called by {@link PyLib#stopPython()} while the interpreter still runs.
+     * The plans are removed from the map before they are disposed, so that no new call picks them up. Calls which
+     * have already picked up a plan must have returned, though.
+     *
+     * @param classLoader The class loader of the interfaces, or {@code null}.
+     */
+    static void disposeCallPlans(ClassLoader classLoader) {
+        List<Long> plans = new ArrayList<>();
+        for (Map.Entry<Method, Long> entry : callPlans.entrySet()) {
+            if ((classLoader == null || entry.getKey().getDeclaringClass().getClassLoader() == classLoader)
+                    && callPlans.remove(entry.getKey(), entry.getValue())) {
+                plans.add(entry.getValue());
+            }
+        }
+        for (Long plan : plans) {
+            PyLib.disposeCallPlan(plan);
+        }
+    }
+
+    /**
+     * @return The number of call plans currently held. Used for testing only.
+     */
+    static int getCallPlanCount() {
+        return callPlans.size();
     }
 }
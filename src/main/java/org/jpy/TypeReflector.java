@@ -0,0 +1,231 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Set;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Loads Java classes and reflects their public members on a pool of worker threads.
+ * Used by the Python function {@code jpy.preload()}, which calls {@link #reflect} without holding the Python GIL
+ * and then creates the Python types from the returned member signatures.
+ *
+ * @since 0.9
+ */
+class TypeReflector {
+
+    /**
+     * The worker threads shared by all calls of {@link #reflect}, created on first use. Idle threads terminate.
+     */
+    private static ExecutorService executor;
+
+    /**
+     * Loads and reflects the given classes and their super classes. If {@code recursive} is set, the classes used
+     * as parameter, return and field types by the public members of these classes are reflected too.
+     *
+     * @param classNames The fully qualified class names, as used by {@link Class#forName(String)}.
+     * @param recursive  Whether to reflect the classes of the member types too.
+     * @return Pairs of a class and its member metadata. The member metadata is an array of
+     * (name, modifiers, JNI signature) triples, one for each public constructor, method and field.
+     * Constructors are named {@code "<init>"}. Classes that can't be loaded are skipped.
+     */
+    static Object[] reflect(String[] classNames, boolean recursive) throws InterruptedException {
+        ClassLoader classLoader = ClassLoader.getSystemClassLoader();
+        ExecutorService executor = getExecutor();
+
+        Set<Class<?>> classes = new LinkedHashSet<>();
+        for (Future<Class<?>> future : executor.invokeAll(createLoadTasks(classNames, classLoader))) {
+            addWithSuperclasses(classes, getResult(future));
+        }
+
+        List<Object> result = new ArrayList<>();
+        Set<Class<?>> memberTypes = new LinkedHashSet<>();
+        reflectAll(executor, classes, result, memberTypes);
+        if (recursive) {
+            // Member types are resolved after their super classes, so these are needed too
+            Set<Class<?>> memberClasses = new LinkedHashSet<>();
+            for (Class<?> memberType : memberTypes) {
+                addWithSuperclasses(memberClasses, memberType);
+            }
+            memberClasses.removeAll(classes);
+            reflectAll(executor, memberClasses, result, new LinkedHashSet<Class<?>>());
+        }
+        return result.toArray();
+    }
+
+    private static synchronized ExecutorService getExecutor() {
+        if (executor == null) {
+            int threadCount = Math.max(1, Runtime.getRuntime().availableProcessors());
+            ThreadPoolExecutor threadPool = new ThreadPoolExecutor(threadCount, threadCount, 30, TimeUnit.SECONDS,
+                                                                   new LinkedBlockingQueue<Runnable>(), new ThreadFactory() {
+                @Override
+                public Thread newThread(Runnable runnable) {
+                    Thread thread = new Thread(runnable, "jpy-type-reflector");
+                    thread.setDaemon(true);
+                    return thread;
+                }
+            });
+            threadPool.allowCoreThreadTimeOut(true);
+            executor = threadPool;
+        }
+        return executor;
+    }
+
+    private static void addWithSuperclasses(Set<Class<?>> classes, Class<?> type) {
+        for (; type != null; type = type.getSuperclass()) {
+            classes.add(type);
+        }
+    }
+
+    private static List<Callable<Class<?>>> createLoadTasks(String[] classNames, final ClassLoader classLoader) {
+        List<Callable<Class<?>>> tasks = new ArrayList<>();
+        for (final String className : classNames) {
+            tasks.add(new Callable<Class<?>>() {
+                @Override
+                public Class<?> call() throws Exception {
+                    try {
+                        return Class.forName(className, true, classLoader);
+                    } catch (ClassNotFoundException | LinkageError e) {
+                        return null;
+                    }
+                }
+            });
+        }
+        return tasks;
+    }
+
+    private static void reflectAll(ExecutorService executor, Set<Class<?>> classes, List<Object> result, Set<Class<?>> memberTypes) throws InterruptedException {
+        List<ReflectTask> tasks = new ArrayList<>();
+        for (Class<?> type : classes) {
+            if (!type.isPrimitive()) {
+                tasks.add(new ReflectTask(type));
+            }
+        }
+        List<Future<String[]>> futures = executor.invokeAll(tasks);
+        for (int i = 0; i < tasks.size(); i++) {
+            String[] members = getResult(futures.get(i));
+            if (members != null) {
+                result.add(tasks.get(i).type);
+                result.add(members);
+                memberTypes.addAll(tasks.get(i).memberTypes);
+            }
+        }
+    }
+
+    private static <T> T getResult(Future<T> future) throws InterruptedException {
+        try {
+            return future.get();
+        } catch (ExecutionException e) {
+            return null;
+        }
+    }
+
+    /**
+     * Reflects the public members of a single class, in the same way as jpy does when it resolves a type.
+     */
+    private static class ReflectTask implements Callable<String[]> {
+        final Class<?> type;
+        final Set<Class<?>> memberTypes = new LinkedHashSet<>();
+
+        ReflectTask(Class<?> type) {
+            this.type = type;
+        }
+
+        @Override
+        public String[] call() {
+            List<String> members = new ArrayList<>();
+            for (Constructor<?> constructor : type.getDeclaredConstructors()) {
+                if (Modifier.isPublic(constructor.getModifiers())) {
+                    addMember(members, "<init>", constructor.getModifiers(), getSignature(constructor.getParameterTypes(), Void.TYPE));
+                }
+            }
+            for (Method method : type.isInterface() ? type.getMethods() : type.getDeclaredMethods()) {
+                if (Modifier.isPublic(method.getModifiers())) {
+                    addMember(members, method.getName(), method.getModifiers(), getSignature(method.getParameterTypes(), method.getReturnType()));
+                }
+            }
+            for (Field field : type.isInterface() ? type.getFields() : type.getDeclaredFields()) {
+                if (Modifier.isPublic(field.getModifiers())) {
+                    addMember(members, field.getName(), field.getModifiers(), getSignature(field.getType()));
+                }
+            }
+            return members.toArray(new String[members.size()]);
+        }
+
+        private void addMember(List<String> members, String name, int modifiers, String signature) {
+            members.add(name);
+            members.add(Integer.toString(modifiers));
+            members.add(signature);
+        }
+
+        private String getSignature(Class<?>[] parameterTypes, Class<?> returnType) {
+            StringBuilder signature = new StringBuilder("(");
+            for (Class<?> parameterType : parameterTypes) {
+                signature.append(getSignature(parameterType));
+            }
+            return signature.append(')').append(getSignature(returnType)).toString();
+        }
+
+        private String getSignature(Class<?> memberType) {
+            Class<?> elementType = memberType;
+            while (elementType.isArray()) {
+                elementType = elementType.getComponentType();
+            }
+            if (!elementType.isPrimitive()) {
+                memberTypes.add(elementType);
+            }
+
+            if (memberType.isArray()) {
+                return memberType.getName().replace('.', '/');
+            } else if (memberType == Boolean.TYPE) {
+                return "Z";
+            } else if (memberType == Character.TYPE) {
+                return "C";
+            } else if (memberType == Byte.TYPE) {
+                return "B";
+            } else if (memberType == Short.TYPE) {
+                return "S";
+            } else if (memberType == Integer.TYPE) {
+                return "I";
+            } else if (memberType == Long.TYPE) {
+                return "J";
+            } else if (memberType == Float.TYPE) {
+                return "F";
+            } else if (memberType == Double.TYPE) {
+                return "D";
+            } else if (memberType == Void.TYPE) {
+                return "V";
+            } else {
+                return "L" + memberType.getName().replace('.', '/') + ";";
+            }
+        }
+    }
+}
@@ -85,6 +85,76 @@ public class PyLibTest {
         assertTrue(pyObject != 0);
     }
 
+    @Test
+    public void testInternName() throws Exception {
+        long name1 = PyLib.internName("path");
+        long name2 = PyLib.internName(new String("path"));
+        assertTrue(name1 != 0);
+        // Equal Java strings give the same interned Python string
+        assertEquals(name1, name2);
+        assertEquals("path", new PyObject(name1).getStringValue());
+        PyLib.decRef(name1);
+        PyLib.decRef(name2);
+
+        // Names too long for the name cache are interned as well
+        String longName = "a_very_long_attribute_name_that_does_not_fit_into_the_name_cache";
+        name1 = PyLib.internName(longName);
+        name2 = PyLib.internName(new String(longName));
+        assertEquals(name1, name2);
+        assertEquals(longName, new PyObject(name1).getStringValue());
+        PyLib.decRef(name1);
+        PyLib.decRef(name2);
+
+        // Different names sharing a cache slot must not be confused
+        for (int i = 0; i < 1000; i++) {
+            long name = PyLib.internName("name" + i);
+            assertEquals("name" + i, new PyObject(name).getStringValue());
+            PyLib.decRef(name);
+        }
+    }
+
+    @Test(expected = RuntimeException.class)
+    public void testInternNullName() throws Exception {
+        PyLib.internName(null);
+    }
+
+    @Test
+    public void testGetInternedAttributeObject() throws Exception {
+        long pyModule = PyLib.importModule("jpy");
+        assertTrue(pyModule != 0);
+
+        PyLib.setAttributeValue(pyModule, "_hello", "Hello Python!", String.class);
+
+        long name = PyLib.internName("_hello");
+        long pyObject = PyLib.getInternedAttributeObject(pyModule, name);
+        assertTrue(pyObject != 0);
+        assertEquals("Hello Python!", new PyObject(pyObject).getStringValue());
+        PyLib.decRef(name);
+    }
+
+    @Test
+    public void testCallInternedAndReturnObject() throws Exception {
+        long builtins;
+
+        try {
+            //Python 3.3
+            builtins = PyLib.importModule("builtins");
+        } catch (Exception e) {
+            //Python 2.7
+            builtins = PyLib.importModule("__builtin__");
+        }
+        assertTrue(builtins != 0);
+
+        long name = PyLib.internName("max");
+        long pointer = PyLib.callInternedAndReturnObject(builtins, false, name, 2, new Object[]{"A", "Z"}, null);
+        assertTrue(pointer != 0);
+        assertEquals("Z", new PyObject(pointer).getStringValue());
+        pointer = PyLib.callInternedAndReturnObject(builtins, false, name, 2, new Object[]{"X", "B"}, new Class[]{String.class, String.class});
+        assertTrue(pointer != 0);
+        assertEquals("X", new PyObject(pointer).getStringValue());
+        PyLib.decRef(name);
+    }
+
     @Test
     public void testCallAndReturnValue() throws Exception {
         long builtins;
@@ -130,4 +200,32 @@ public class PyLibTest {
         //PyLib.Diag.setFlags(PyLib.Diag.F_ALL);
         assertEquals("Z", new PyObject(pointer).getStringValue());
     }
+
+    @Test
+    public void testCallPlanAndReturnValue() throws Exception {
+        long builtins;
+
+        try {
+            //Python 3.3
+            builtins = PyLib.importModule("builtins");
+        } catch (Exception e) {
+            //Python 2.7
+            builtins = PyLib.importModule("__builtin__");
+        }
+        assertTrue(builtins != 0);
+
+        long plan = PyLib.createCallPlan("max", new Class[]{String.class, String.class}, String.class);
+        assertTrue(plan != 0);
+        try {
+            String result = PyLib.callPlanAndReturnValue(builtins, false, plan, new Object[]{"A", "Z"});
+            assertEquals("Z", result);
+            result = PyLib.callPlanAndReturnValue(builtins, false, plan, new Object[]{"X", "B"});
+            assertEquals("X", result);
+        } finally {
+            PyLib.disposeCallPlan(plan);
+        }
+
+        // Disposing a null plan is a no-op
+        PyLib.disposeCallPlan(0);
+    }
 }
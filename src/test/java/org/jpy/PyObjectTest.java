@@ -197,6 +197,33 @@ public class PyObjectTest {
         testCallProxySingleThreaded(procObj);
     }
 
+    @Test
+    public void testCreateProxyCallPlans() throws Exception {
+        PyModule procModule = PyModule.importModule("proc_class");
+        Processor processor1 = procModule.call("Processor").createProxy(Processor.class);
+        Processor processor2 = procModule.call("Processor").createProxy(Processor.class);
+
+        assertEquals("initialize", processor1.initialize());
+        assertEquals("computeTile-100,100", processor1.computeTile(100, 100, new float[100 * 100]));
+        int planCount = PyProxyHandler.getCallPlanCount();
+        assertTrue(planCount >= 2);
+
+        // Proxies of the same interface share the plans of its methods
+        assertEquals("initialize", processor2.initialize());
+        assertEquals("computeTile-200,100", processor2.computeTile(200, 100, new float[100 * 100]));
+        assertEquals(planCount, PyProxyHandler.getCallPlanCount());
+
+        // Plans of the interfaces of a class loader are disposed on request and created again on demand
+        PyLib.disposeProxyCallPlans(Processor.class.getClassLoader());
+        assertEquals(0, PyProxyHandler.getCallPlanCount());
+        assertEquals("initialize", processor1.initialize());
+        assertEquals(1, PyProxyHandler.getCallPlanCount());
+
+        // Stopping Python disposes all plans
+        PyLib.stopPython();
+        assertEquals(0, PyProxyHandler.getCallPlanCount());
+    }
+
     // see https://github.com/bcdev/jpy/issues/26
     @Test
     public void testCreateProxyAndCallMultiThreaded() throws Exception {
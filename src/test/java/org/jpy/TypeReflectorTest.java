@@ -0,0 +1,59 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import org.jpy.fixtures.Thing;
+import org.jpy.fixtures.TypeResolutionTestFixture;
+import org.junit.Test;
+
+import java.util.Arrays;
+import java.util.List;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+public class TypeReflectorTest {
+
+    @Test
+    public void testReflect() throws Exception {
+        Object[] result = TypeReflector.reflect(new String[]{"org.jpy.fixtures.TypeResolutionTestFixture", "no.such.Class"}, false);
+        List<Object> classes = Arrays.asList(result[0], result[2]);
+        assertEquals(4, result.length);
+        assertTrue(classes.contains(TypeResolutionTestFixture.class));
+        assertTrue(classes.contains(Object.class));
+
+        List<String> members = Arrays.asList((String[]) result[classes.indexOf(TypeResolutionTestFixture.class) * 2 + 1]);
+        int index = members.indexOf("createSuperThing");
+        assertEquals("1", members.get(index + 1));
+        assertEquals("(I)Lorg/jpy/fixtures/TypeResolutionTestFixture$SuperThing;", members.get(index + 2));
+        index = members.indexOf("<init>");
+        assertEquals("()V", members.get(index + 2));
+    }
+
+    @Test
+    public void testReflectRecursive() throws Exception {
+        Object[] result = TypeReflector.reflect(new String[]{"org.jpy.fixtures.TypeResolutionTestFixture"}, true);
+        List<Object> items = Arrays.asList(result);
+        assertTrue(items.contains(TypeResolutionTestFixture.SuperThing.class));
+        // Super classes of member types are reflected too
+        assertTrue(items.contains(Thing.class));
+
+        // The worker threads are reused by subsequent calls
+        result = TypeReflector.reflect(new String[]{"org.jpy.fixtures.Thing"}, false);
+        assertTrue(Arrays.asList(result).contains(Thing.class));
+    }
+}
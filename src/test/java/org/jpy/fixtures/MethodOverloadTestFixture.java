@@ -82,6 +82,17 @@ public class MethodOverloadTestFixture {
         }
     }
 
+    /**
+     * Used to test that overloads overridden in derived classes are selected
+     */
+    public static class MethodOverloadTestFixture3 extends MethodOverloadTestFixture {
+
+        @Override
+        public String join(String a) {
+            return "Override:" + stringifyArgs(a);
+        }
+    }
+
     //////////////////////////////////////////////
 
     // Should never been found, since 'float' is not present in Python
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy.fixtures;
+
+/**
+ * Used as a test class for the type metadata test cases in jpy_typeres_test.py.
+ * The classes must not be used by any other test, since a type is resolved only once.
+ */
+@SuppressWarnings("UnusedDeclaration")
+public class TypeMetadataTestFixture {
+
+    public int value;
+
+    public int getValue() {
+        return value;
+    }
+
+    public void setValue(int value) {
+        this.value = value;
+    }
+
+    /**
+     * Resolved using type metadata that lacks a member added to the class.
+     */
+    public static class Extended {
+
+        public int value;
+
+        public int getValue() {
+            return value;
+        }
+
+        public void setValue(int value) {
+            this.value = value;
+        }
+
+        public void reset() {
+            value = 0;
+        }
+    }
+
+    /**
+     * Resolved using type metadata that does not match the class.
+     */
+    public static class Changed {
+
+        public int value;
+
+        public int getValue() {
+            return value;
+        }
+
+        public void setValue(int value) {
+            this.value = value;
+        }
+    }
+}
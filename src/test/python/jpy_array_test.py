@@ -98,6 +98,127 @@ class TestJavaArrays(unittest.TestCase):
         self.do_test_array_protocol('java.lang.Object', [None, None, None], [File('A'), 'B', 3])
 
 
+    def test_array_from_buffer(self):
+        import array
+        a = jpy.array('int', array.array('i', [-2147483648, 100, 2147483647]))
+        self.assertEqual(a[0], -2147483648)
+        self.assertEqual(a[1], 100)
+        self.assertEqual(a[2], 2147483647)
+        a = jpy.array('double', array.array('d', [-1.5, 0.25, 3.0]))
+        self.assertEqual(a[0], -1.5)
+        self.assertEqual(a[1], 0.25)
+        self.assertEqual(a[2], 3.0)
+        # Compatible item formats are converted
+        a = jpy.array('double', array.array('h', [-3, 0, 7]))
+        self.assertEqual(a[0], -3.0)
+        self.assertEqual(a[1], 0.0)
+        self.assertEqual(a[2], 7.0)
+        a = jpy.array('long', array.array('b', [-3, 0, 7]))
+        self.assertEqual(a[0], -3)
+        self.assertEqual(a[1], 0)
+        self.assertEqual(a[2], 7)
+        a = jpy.array('boolean', array.array('B', [2, 0, 1]))
+        self.assertEqual(a[0], True)
+        self.assertEqual(a[1], False)
+        self.assertEqual(a[2], True)
+        a = jpy.array('byte', bytearray(b'\x00\x7f\xff'))
+        self.assertEqual(a[0], 0)
+        self.assertEqual(a[1], 127)
+        self.assertEqual(a[2], -1)
+
+
+    def test_buffer_args(self):
+        import array
+        Arrays = jpy.get_type('java.util.Arrays')
+        # The overloads for all primitive array types are matched against the same buffer
+        self.assertEqual(Arrays.hashCode(array.array('i', [1, 2, 3])), 30817)
+        self.assertEqual(Arrays.hashCode(array.array('d', [1.5])), Arrays.hashCode(jpy.array('double', [1.5])))
+        # The buffer must be released after the call
+        b = bytearray(b'abc')
+        Arrays.hashCode(b)
+        b.extend(b'def')
+        self.assertEqual(len(b), 6)
+        # Each buffer argument keeps its own buffer, and all are released after the call
+        a1 = bytearray(b'xyz')
+        a2 = bytearray(b'xyz')
+        self.assertTrue(Arrays.equals(a1, a2))
+        self.assertFalse(Arrays.equals(array.array('i', [1, 2]), array.array('i', [1, 3])))
+        a1.extend(b'w')
+        a2.extend(b'w')
+        self.assertEqual(len(a1) + len(a2), 8)
+
+
+    @unittest.skipIf(sys.version_info < (3, 2, 0), "memoryview is not a context manager in Python < 3.2")
+    def test_critical_view(self):
+        a = jpy.array('int', [1, 2, 3])
+        b = jpy.array('int', 0)
+        c = jpy.array('int', 3)
+        f = jpy.get_type('java.io.File')('x')
+        copy = memoryview(c)
+        with jpy.critical_view(a) as m:
+            self.assertEqual(m.readonly, False)
+            self.assertEqual(m.tolist(), [1, 2, 3])
+            m[1] = 20
+            # No Java access while the view is in use
+            with self.assertRaises(RuntimeError):
+                a[0]
+            # Critical views can't be nested
+            with self.assertRaises(RuntimeError):
+                jpy.critical_view(b)
+            # The Java object and the copied elements are only released after the view
+            del f
+            copy.release()
+        self.assertEqual(a[1], 20)
+        self.assertEqual(c[0], 0)
+        m = jpy.critical_view(a)
+        with self.assertRaises(RuntimeError):
+            len(c)
+        m.release()
+        self.assertEqual(len(c), 3)
+        with jpy.critical_view(b) as m2:
+            self.assertEqual(len(m2), 0)
+        with self.assertRaises(ValueError):
+            jpy.critical_view([1, 2, 3])
+
+
+    def test_array_slices(self):
+        a = jpy.array('int', [0, 1, 2, 3, 4, 5])
+        self.assertEqual(a[-1], 5)
+        self.assertEqual(a[1:4], [1, 2, 3])
+        self.assertEqual(a[::2], [0, 2, 4])
+        self.assertEqual(a[::-2], [5, 3, 1])
+        self.assertEqual(a[4:1], [])
+        self.assertEqual(a.tolist(), [0, 1, 2, 3, 4, 5])
+        self.assertEqual(list(a), [0, 1, 2, 3, 4, 5])
+        a[1:3] = [10, 20]
+        a[::3] = (30, 40)
+        self.assertEqual(a.tolist(), [30, 10, 20, 40, 4, 5])
+        with self.assertRaises(ValueError):
+            a[1:3] = [1, 2, 3]
+        with self.assertRaises(IndexError):
+            a[6]
+
+        a = jpy.array('java.lang.String', ['A', 'B', 'C', 'D'])
+        self.assertEqual(a[-2], 'C')
+        self.assertEqual(a[1:], ['B', 'C', 'D'])
+        a[::2] = ['X', None]
+        self.assertEqual(a.tolist(), ['X', 'B', None, 'D'])
+        # Wrapped Java objects keep their references when assigned
+        String = jpy.get_type('java.lang.String')
+        x = String('x')
+        y = String('y')
+        a[0:2] = [x, y]
+        self.assertEqual(a.tolist(), ['x', 'y', None, 'D'])
+        self.assertEqual(x.toUpperCase(), 'X')
+
+        File = jpy.get_type('java.io.File')
+        f = File('f')
+        a = jpy.array(File, 3)
+        a[1:] = [f, f]
+        self.assertEqual(a[2].getName(), 'f')
+        self.assertEqual(f.getName(), 'f')
+
+
     # see https://github.com/bcdev/jpy/issues/52
     def test_array_item_del(self):
         Integer = jpy.get_type('java.lang.Integer')
@@ -37,6 +37,29 @@ class TestJavaArrays(unittest.TestCase):
         self.assertEqual(jpy.diag.flags, 12)
 
 
+    def test_diag_local_frames(self):
+        String = jpy.get_type('java.lang.String')
+        s = String('abc')
+        self.assertEqual(jpy.diag.local_frames, 0)
+        for i in range(100):
+            self.assertEqual(s.length(), 3)
+            self.assertEqual(s.substring(1), 'bc')
+        self.assertEqual(jpy.diag.local_frames, 0)
+        with self.assertRaises(Exception):
+            s.substring(10)
+        self.assertEqual(jpy.diag.local_frames, 0)
+        a = jpy.array('java.lang.String', ['x', 'y'])
+        self.assertEqual(str(s), 'abc')
+        self.assertEqual(hash(s), hash(String('abc')))
+        self.assertTrue(s == String('abc'))
+        self.assertEqual(a[1], 'y')
+        self.assertEqual(a[0:2], ['x', 'y'])
+        self.assertIsNotNone(jpy.cast(s, 'java.lang.CharSequence'))
+        self.assertEqual(jpy.diag.local_frames, 0)
+        with self.assertRaises(AttributeError):
+            jpy.diag.local_frames = 0
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
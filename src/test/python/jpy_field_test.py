@@ -33,6 +33,41 @@ class TestFields(unittest.TestCase):
         self.assertEqual(self.Fixture.l_OBJ_STATIC_FIELD, self.Thing(123))
 
 
+    def test_static_fields_of_instances(self):
+        fixture = self.Fixture()
+        self.assertEqual(fixture.i_STATIC_FIELD, 123456789)
+        self.assertEqual(fixture.S_OBJ_STATIC_FIELD, 'ABC')
+        self.assertEqual(self.Fixture.i_STATIC_FIELD, 123456789)
+        self.assertEqual(self.Fixture.S_OBJ_STATIC_FIELD, 'ABC')
+        with self.assertRaises(AttributeError):
+            fixture.i_STATIC_FIELD = 0
+        self.assertEqual(self.Fixture.i_STATIC_FIELD, 123456789)
+
+
+    def test_instance_field_descriptors(self):
+        fixture1 = self.Fixture()
+        fixture2 = self.Fixture()
+
+        # Instance fields accessed through the class are not bound
+        field = self.Fixture.iInstField
+        self.assertIsInstance(field, jpy.JField)
+        self.assertEqual(field.name, 'iInstField')
+        self.assertFalse(field.is_static)
+
+        fixture1.iInstField = 42
+        self.assertEqual(fixture1.iInstField, 42)
+        self.assertEqual(fixture2.iInstField, 0)
+        self.assertEqual(field.__get__(fixture1), 42)
+        field.__set__(fixture2, 7)
+        self.assertEqual(fixture2.iInstField, 7)
+        self.assertEqual(fixture1.iInstField, 42)
+
+        with self.assertRaises(AttributeError):
+            del fixture1.iInstField
+        with self.assertRaises(TypeError):
+            field.__set__(object(), 1)
+
+
     def test_primitive_instance_fields(self):
         fixture = self.Fixture()
         self.assertEqual(fixture.zInstField, False)
@@ -51,6 +51,16 @@ class TestGetClass(unittest.TestCase):
         self.assertEqual(str(DoublePoint), TYPE_STR_PREFIX + "'java.awt.geom.Point2D$Double'>")
 
 
+    def test_get_class_removed_from_types(self):
+        Locale = jpy.get_type('java.util.Locale')
+        self.assertEqual(Locale('de').getLanguage(), 'de')
+        del jpy.types['java.util.Locale']
+        # The type may be served from the native type cache, but must still be usable
+        Locale = jpy.get_type('java.util.Locale')
+        self.assertEqual(Locale('fr').getLanguage(), 'fr')
+        self.assertEqual(Locale.getDefault().getClass().getName(), 'java.util.Locale')
+
+
     def test_get_class_of_unknown_type(self):
         with  self.assertRaises(ValueError) as e:
             String = jpy.get_type('java.lang.Spring')
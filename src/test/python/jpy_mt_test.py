@@ -1,4 +1,5 @@
 import threading
+import time
 import unittest
 import jpyutil
 
@@ -43,6 +44,62 @@ class TestMultipleThreads(unittest.TestCase):
         self.assertEqual(345, t3.intValue)
         self.assertEqual(456, t4.intValue)
 
+    def test_multi_thread_access_with_released_gil(self):
+
+        Thread = jpy.get_type('java.lang.Thread')
+        sleep = [m for m in Thread.sleep.methods if m.param_count == 1][0]
+        self.assertFalse(sleep.release_gil)
+
+        def run():
+            Thread.sleep(500)
+
+        sleep.release_gil = True
+        try:
+            threads = [threading.Thread(target=run) for i in range(4)]
+            t0 = time.time()
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            t1 = time.time()
+        finally:
+            sleep.release_gil = False
+
+        # With the GIL held, the 4 threads would sleep one after the other
+        self.assertLess(t1 - t0, 4 * 0.5)
+
+    def test_threads_detached_on_exit(self):
+        Integer = jpy.get_type('java.lang.Integer')
+        ManagementFactory = jpy.get_type('java.lang.management.ManagementFactory')
+        threadBean = ManagementFactory.getThreadMXBean()
+        count0 = threadBean.getThreadCount()
+        local = threading.local()
+
+        def run(value):
+            # Java objects held by the thread state are released after the thread has been detached
+            local.intObj = Integer(value)
+            self.assertEqual(local.intObj.intValue(), value)
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(8)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        for i in range(50):
+            if threadBean.getThreadCount() <= count0:
+                break
+            time.sleep(0.1)
+        self.assertLessEqual(threadBean.getThreadCount(), count0)
+
+    def test_set_release_gil(self):
+        self.assertFalse(jpy.set_release_gil(True))
+        try:
+            Integer = jpy.get_type('java.lang.Integer')
+            self.assertEqual(Integer(123).intValue(), 123)
+        finally:
+            self.assertTrue(jpy.set_release_gil(False))
+
 
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
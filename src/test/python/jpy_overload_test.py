@@ -60,6 +60,22 @@ class TestMethodOverloads(unittest.TestCase):
             fixture.join(object(), 32)
         self.assertEqual(str(e.exception), 'no matching Java method overloads found')
 
+    def test_resolvedOverloadsAreCached(self):
+        fixture = self.Fixture()
+        join = self.Fixture.join
+
+        self.assertEqual(fixture.join(12, 32), 'Integer(12),Integer(32)')
+        hits = join.cache_hits
+        misses = join.cache_misses
+        self.assertEqual(fixture.join(13, 33), 'Integer(13),Integer(33)')
+        self.assertEqual(join.cache_hits, hits + 1)
+        self.assertEqual(join.cache_misses, misses)
+
+        # Other argument types must still select other overloads
+        self.assertEqual(fixture.join(13, 'abc'), 'Integer(13),String(abc)')
+        self.assertEqual(fixture.join(1.3, 33), 'Double(1.3),Integer(33)')
+        self.assertEqual(fixture.join(13, 33), 'Integer(13),Integer(33)')
+
     def test_nArgOverloads(self):
         fixture = self.Fixture()
 
@@ -85,6 +101,35 @@ class TestMethodOverloads(unittest.TestCase):
         self.assertEqual(str(e.exception), 'no matching Java method overloads found')
 
 
+    def test_overridesInDerivedClassAreSelected(self):
+        Fixture = jpy.get_type('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture3')
+        fixture = Fixture()
+
+        self.assertEqual(fixture.join('x'), 'Override:String(x)')
+        self.assertEqual(fixture.join('x', 'y'), 'String(x),String(y)')
+        self.assertEqual(fixture.join(12, 32), 'Integer(12),Integer(32)')
+        # Java calls the override, even if called through the base class
+        self.assertEqual(self.Fixture.join(fixture, 'x'), 'Override:String(x)')
+
+    def test_resolvedOverloadsStayCachedWhenOtherTypesAreResolved(self):
+        Fixture = jpy.get_type('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture3')
+        fixture = Fixture()
+        join = Fixture.join
+
+        self.assertEqual(fixture.join('x'), 'Override:String(x)')
+        self.assertEqual(fixture.join('x', 'y'), 'String(x),String(y)')
+        hits = join.cache_hits
+        misses = join.cache_misses
+
+        # Resolving an unrelated type must not invalidate the resolved overloads
+        jpy.get_type('java.util.concurrent.ConcurrentSkipListSet', resolve=True)
+
+        self.assertEqual(fixture.join('y'), 'Override:String(y)')
+        self.assertEqual(fixture.join('y', 'z'), 'String(y),String(z)')
+        self.assertEqual(join.cache_hits, hits + 2)
+        self.assertEqual(join.cache_misses, misses)
+
+
 class TestOtherMethodResolutionCases(unittest.TestCase):
 
     # see https://github.com/bcdev/jpy/issues/55
@@ -129,6 +174,22 @@ class TestOtherMethodResolutionCases(unittest.TestCase):
         # without the fix, we get str(s) = "java.lang.String@xxxxxx"
         self.assertEqual(str(s), '[A, B, C]')
 
+    def test_argsMatchInterfacesOfSuperClasses(self):
+        ArrayList = jpy.get_type('java.util.ArrayList')
+        HashSet = jpy.get_type('java.util.HashSet')
+        Object = jpy.get_type('java.lang.Object')
+        s = HashSet()
+        s.add('A')
+        l = ArrayList()
+        # HashSet implements java.util.Collection via java.util.AbstractSet and java.util.AbstractCollection
+        self.assertTrue(l.addAll(s))
+        # The declared type java.lang.Object is not assignable, but the object itself is a java.util.Collection
+        self.assertTrue(l.addAll(jpy.cast(s, Object)))
+        self.assertEqual(l.size(), 2)
+        with self.assertRaises(RuntimeError) as e:
+            l.addAll(Object())
+        self.assertEqual(str(e.exception), 'no matching Java method overloads found')
+
 
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
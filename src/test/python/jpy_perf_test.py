@@ -43,6 +43,40 @@ class TestPerformance(unittest.TestCase):
         print('HashMap.get() took', t1-t0, 's for', N, 'calls, this is', 1000*(t1-t0)/N, 'ms per call')
 
 
+    def test_method_call_perf(self):
+
+        Integer = jpy.get_type('java.lang.Integer')
+        String = jpy.get_type('java.lang.String')
+
+        # 1 million
+        N = 1000000
+
+        s = String('abcdef')
+
+        t0 = time.time()
+        for i in range(N):
+            s.length()
+        t1 = time.time()
+        print('String.length() took', t1-t0, 's for', N, 'calls, this is', 1000*(t1-t0)/N, 'ms per call')
+
+        t0 = time.time()
+        for i in range(N):
+            Integer.compare(i, 10)
+        t1 = time.time()
+        print('Integer.compare(int, int) took', t1-t0, 's for', N, 'calls, this is', 1000*(t1-t0)/N, 'ms per call')
+
+        t0 = time.time()
+        for i in range(N):
+            s.regionMatches(True, 1, 'BCD', 0, 3)
+        t1 = time.time()
+        print('String.regionMatches(boolean, int, String, int, int) took', t1-t0, 's for', N, 'calls, this is', 1000*(t1-t0)/N, 'ms per call')
+
+        t0 = time.time()
+        for i in range(N):
+            Integer(i)
+        t1 = time.time()
+        print('Integer(int) construction took', t1-t0, 's for', N, 'calls, this is', 1000*(t1-t0)/N, 'ms per call')
+
 
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
@@ -1,5 +1,6 @@
 import unittest
 import sys
+import array
 
 import jpyutil
 
@@ -24,6 +25,18 @@ class TestString(unittest.TestCase):
         self.assertEqual(str(s), 'Bibo')
 
 
+    def test_constructor_with_keyword_arguments(self):
+        with self.assertRaises(TypeError):
+            self.String(value='Bibo')
+        with self.assertRaises(TypeError):
+            self.String('Bibo', offset=0)
+        # The same type called the regular way
+        with self.assertRaises(TypeError):
+            type(self.String).__call__(self.String, 'Bibo', offset=0)
+        s = self.String(*['Bibo'], **{})
+        self.assertEqual(str(s), 'Bibo')
+
+
     def test_unicode_constructor_with_py27(self):
         # This test is actually the same as test_constructor(), but 'str' is not 'unicode' in Python 2.7
         s = self.String(u'Bibo')
@@ -47,6 +60,30 @@ class TestString(unittest.TestCase):
         self.assertEqual(s2, 'bo')
 
 
+    def test_unbound_method(self):
+        s = self.String('Bibo')
+        # Methods accessed through the class are not bound, 'self' is passed explicitly
+        self.assertIs(self.String.substring, self.String.__dict__['substring'])
+        self.assertEqual(self.String.substring(s, 0, 2), 'Bi')
+        self.assertEqual(self.String.length(s), 4)
+        with self.assertRaises(RuntimeError):
+            self.String.length()
+        with self.assertRaises(RuntimeError):
+            self.String.length(None)
+        with self.assertRaises(RuntimeError):
+            self.String.length('Bibo')
+
+
+    def test_map(self):
+        s = self.String('Bibo')
+        self.assertEqual(self.String.substring.map([(s, 0, 2), (s, 2), (s, 1, 3)]), ['Bi', 'bo', 'ib'])
+        self.assertEqual(self.String.substring.map([]), [])
+        Integer = jpy.get_type('java.lang.Integer')
+        self.assertEqual(Integer.parseInt.map(str(i) for i in range(5)), [0, 1, 2, 3, 4])
+        with self.assertRaises(RuntimeError):
+            Integer.parseInt.map([('1',), (2.5, 'x')])
+
+
     def test_split(self):
         s = self.String('/usr/local/bibo')
         self.assertTrue('split' in self.String.__dict__)
@@ -212,6 +249,114 @@ class TestHashMap(unittest.TestCase):
         self.assertEqual(hash_map.get(4), fa)
 
 
+class TestMath(unittest.TestCase):
+    def setUp(self):
+        self.Math = jpy.get_type('java.lang.Math')
+        self.assertIsNotNone(self.Math)
+
+
+    def test_call_many(self):
+        a = array.array('d', [1.0, 5.0, -2.0])
+        b = array.array('d', [3.0, 2.0, -1.0])
+        result = self.Math.max.call_many(a, b)
+        self.assertEqual(str(type(result)), "<class '[D'>")
+        self.assertEqual(result.tolist(), [3.0, 5.0, -1.0])
+
+        a = array.array('i', [1, 5, -2])
+        b = array.array('i', [3, 2, -1])
+        result = self.Math.max.call_many(a, b)
+        self.assertEqual(str(type(result)), "<class '[I'>")
+        self.assertEqual(result.tolist(), [3, 5, -1])
+
+
+    def test_call_many_narrowing(self):
+        Integer = jpy.get_type('java.lang.Integer')
+        result = Integer.bitCount.call_many(array.array('h', [1, 3, -1]))
+        self.assertEqual(result.tolist(), [1, 2, 32])
+
+        # Columns whose values may not fit into an int parameter are not passed
+        with self.assertRaises(RuntimeError) as e:
+            Integer.bitCount.call_many(array.array('q', [1, 3]))
+        self.assertIn('no matching Java method overload', str(e.exception))
+        with self.assertRaises(RuntimeError):
+            Integer.bitCount.call_many(array.array('I', [1, 3]))
+
+
+    def test_call_many_with_out(self):
+        x = array.array('i', [1, 4, 9, 16])
+        out = array.array('d', [0.0] * 4)
+        self.assertIs(self.Math.sqrt.call_many(x, out=out), out)
+        self.assertEqual(out.tolist(), [1.0, 2.0, 3.0, 4.0])
+
+        with self.assertRaises(ValueError):
+            self.Math.sqrt.call_many(x, out=array.array('d', [0.0] * 2))
+        with self.assertRaises(TypeError):
+            self.Math.sqrt.call_many(x, out=array.array('i', [0] * 4))
+        with self.assertRaises(ValueError):
+            self.Math.max.call_many(x, array.array('i', [1]))
+
+
+    def test_call_many_with_undersized_out(self):
+        Integer = jpy.get_type('java.lang.Integer')
+        x = array.array('i', [1, 3, -1])
+        out = array.array('q', [0] * 3)
+        self.assertIs(Integer.bitCount.call_many(x, out=out), out)
+        self.assertEqual(out.tolist(), [1, 2, 32])
+
+        # Buffers whose items can't hold all values of the return type are rejected
+        with self.assertRaises(TypeError):
+            Integer.bitCount.call_many(x, out=array.array('b', [0] * 3))
+        with self.assertRaises(TypeError):
+            Integer.bitCount.call_many(x, out=array.array('I', [0] * 3))
+        with self.assertRaises(TypeError):
+            self.Math.abs.call_many(array.array('q', [1, -2, 3]), out=array.array('i', [0] * 3))
+
+
+@unittest.skipIf(sys.version_info < (3, 3, 0), "memoryview features require Python 3.3+")
+class TestDirectBuffer(unittest.TestCase):
+    def test_direct_buffer(self):
+        data = bytearray(16)
+        byte_buffer = jpy.direct_buffer(data)
+        self.assertTrue(byte_buffer.isDirect())
+        self.assertFalse(byte_buffer.isReadOnly())
+        self.assertEqual(byte_buffer.capacity(), 16)
+
+        # Python and Java access the same memory
+        byte_buffer.put(0, 7)
+        self.assertEqual(data[0], 7)
+        data[1] = 5
+        self.assertEqual(byte_buffer.get(1), 5)
+
+        m = memoryview(byte_buffer)
+        self.assertEqual(len(m), 16)
+        self.assertEqual(m.readonly, False)
+        m[2] = 3
+        self.assertEqual(data[2], 3)
+        m.release()
+
+        int_buffer = byte_buffer.asIntBuffer()
+        int_buffer.put(1, 1234)
+        m = memoryview(int_buffer)
+        self.assertEqual(m.format, 'i')
+        self.assertEqual(m.itemsize, 4)
+        self.assertEqual(len(m), 4)
+        self.assertEqual(m[1], 1234)
+        m.release()
+
+
+    def test_direct_buffer_read_only(self):
+        byte_buffer = jpy.direct_buffer(b'ABC')
+        self.assertTrue(byte_buffer.isReadOnly())
+        self.assertEqual(byte_buffer.get(2), ord('C'))
+        self.assertEqual(memoryview(byte_buffer).readonly, True)
+
+
+    def test_heap_buffer(self):
+        ByteBuffer = jpy.get_type('java.nio.ByteBuffer')
+        with self.assertRaises(BufferError):
+            memoryview(ByteBuffer.allocate(16))
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
@@ -15,14 +15,16 @@ class TestTypeResolution(unittest.TestCase):
 
     def test_ThatTypeIsResolvedLate(self):
         self.assertTrue('org.jpy.fixtures.TypeResolutionTestFixture' in jpy.types)
-        self.assertTrue('org.jpy.fixtures.TypeResolutionTestFixture$SuperThing' in jpy.types)
-        self.assertTrue('org.jpy.fixtures.Thing' in jpy.types)
 
         fixture = self.Fixture()
 
         # Create a thing instance, the type 'org.jpy.fixtures.Thing' is not resolved yet
         thing = fixture.createSuperThing(2001)
 
+        # The return type of 'createSuperThing()' is only looked up when the method is called first
+        self.assertTrue('org.jpy.fixtures.TypeResolutionTestFixture$SuperThing' in jpy.types)
+        self.assertTrue('org.jpy.fixtures.Thing' in jpy.types)
+
         # Assert that 'org.jpy.fixtures.Thing' is not resolved yet
         SuperThing = jpy.types['org.jpy.fixtures.TypeResolutionTestFixture$SuperThing']
         self.assertFalse('add' in SuperThing.__dict__)
@@ -56,6 +58,60 @@ class TestTypeResolution(unittest.TestCase):
         # assert that a method declared of java.io.DataInput is in __dict__
         self.assertTrue('readLine' in ObjectInput.__dict__)
 
+    def test_ThatTypeMetadataCanBeUsedInsteadOfReflection(self):
+        metadata = jpy.get_type_metadata()
+        declared_count, members = metadata['org.jpy.fixtures.TypeResolutionTestFixture']
+        self.assertTrue(declared_count >= len(members))
+        self.assertTrue(('<init>', 1, '()V') in members)
+        self.assertTrue(('createSuperThing', 1, '(I)Lorg/jpy/fixtures/TypeResolutionTestFixture$SuperThing;') in members)
+
+        fixtureName = 'org.jpy.fixtures.TypeMetadataTestFixture'
+        extendedName = 'org.jpy.fixtures.TypeMetadataTestFixture$Extended'
+        changedName = 'org.jpy.fixtures.TypeMetadataTestFixture$Changed'
+        jpy.set_type_metadata({fixtureName: (4, [('<init>', 1, '()V'), ('getValue', 1, '()I'), ('value', 1, 'I')]),
+                               extendedName: (4, [('<init>', 1, '()V'), ('getValue', 1, '()I'), ('setValue', 1, '(I)V'), ('value', 1, 'I')]),
+                               changedName: (4, [('<init>', 1, '()V'), ('getValue', 1, '()I'), ('getValue', 1, '()J')])})
+        try:
+            # Only the members given by the metadata are added
+            Fixture = jpy.get_type(fixtureName)
+            self.assertTrue('getValue' in Fixture.__dict__)
+            self.assertTrue('value' in Fixture.__dict__)
+            self.assertFalse('setValue' in Fixture.__dict__)
+            fixture = Fixture()
+            fixture.value = 3
+            self.assertEqual(fixture.getValue(), 3)
+
+            # A class that declares more members than the metadata says is reflected
+            Extended = jpy.get_type(extendedName)
+            self.assertTrue('reset' in Extended.__dict__)
+            extended = Extended()
+            extended.setValue(7)
+            extended.reset()
+            self.assertEqual(extended.getValue(), 0)
+
+            # A member that can't be bound discards the metadata, all members of the class are reflected
+            Changed = jpy.get_type(changedName)
+            self.assertTrue('getValue' in Changed.__dict__)
+            self.assertTrue('setValue' in Changed.__dict__)
+            changed = Changed()
+            changed.setValue(5)
+            self.assertEqual(changed.getValue(), 5)
+            self.assertEqual(changed.value, 5)
+            self.assertEqual(len(Changed.getValue.methods), 1)
+        finally:
+            jpy.set_type_metadata(None)
+
+    def test_ThatPreloadResolvesTypesAndTheirMemberTypes(self):
+        jpy.preload(['java.util.TreeMap'], recursive=True)
+        TreeMap = jpy.types['java.util.TreeMap']
+        self.assertTrue('firstKey' in TreeMap.__dict__)
+        # 'headMap()' returns a 'java.util.SortedMap'
+        self.assertTrue('java.util.SortedMap' in jpy.types)
+        self.assertTrue('comparator' in jpy.types['java.util.SortedMap'].__dict__)
+
+        with self.assertRaises(ValueError):
+            jpy.preload('no.such.Class')
+
 
 
 if __name__ == '__main__':